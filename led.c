@@ -50,6 +50,10 @@ bool led_init_opt(led_str_t* arg) {
                 case 'm':
                     led.opt.output_match = true;
                     break;
+                case 'M':
+                    led.opt.output_match = true;
+                    led.opt.output_match_all = true;
+                    break;
                 case 'p':
                     led.opt.pack_selected = true;
                     break;
@@ -104,6 +108,16 @@ bool led_init_opt(led_str_t* arg) {
                 case 'U':
                     led.opt.file_out_unchanged = true;
                     break;
+                case 'S':
+                    optstr = led_str_str_at(arg, foreach.i_next);
+                    led_assert(led_uchar_isdigit((uint8_t)*optstr), LED_ERR_ARG, "Bad option -%c, numeric seed expected", foreach.uc);
+                    led.opt.seeded = true;
+                    led.opt.seed = strtoull(optstr, NULL, 10);
+                    led_debug("led_init_opt: seed=%lu", led.opt.seed);
+                    break;
+                case 'c':
+                    led.opt.memo = true;
+                    break;
                 case 'X':
                     led_assert(!led.opt.file_out, LED_ERR_ARG, "Bad option -%c, output file mode already set", foreach.uc);
                     led.opt.exec = true;
@@ -152,6 +166,7 @@ bool led_init_func(led_str_t* arg) {
         if (!led_str_isempty(&regx)) {
             led_debug("led_init_func: regex found=%s", led_str_str(&regx));
             pfunc->regex = led_str_regex_compile(&regx, led.opt.pack_selected ? PCRE2_MULTILINE: 0);
+            led_str_match_iter_init(&pfunc->zn_iter, pfunc->regex);
         }
         else {
             led_debug("led_init_func: regex NOT found, no zone selection");
@@ -177,6 +192,11 @@ bool led_init_sel(led_str_t* arg) {
         led.sel.val_start = strtol(arg->str, NULL, 10);
         led_debug("led_init_sel: selector start: shift after regex=%d", led.sel.val_start);
     }
+    else if (led_str_match_pat(arg, "^-[0-9]+$") && led.sel.type_start == SEL_TYPE_REGEX) {
+        led.sel.lookback = strtol(arg->str + 1, NULL, 10);
+        led_assert(led.sel.lookback < LED_RING_MAX, LED_ERR_ARG, "Negative shift %lu exceed maximum %d", led.sel.lookback, LED_RING_MAX-1);
+        led_debug("led_init_sel: selector start: shift before regex=%lu", led.sel.lookback);
+    }
     else if (!led.sel.type_start) {
         if (led_str_match(arg, LED_REGEX_INTEGER)) {
             led.sel.type_start = SEL_TYPE_COUNT;
@@ -258,6 +278,50 @@ void led_init_config() {
                 led_assert(true, LED_ERR_ARG, "function arg %i: bad internal format (%s)", foreach.i+1, pfn_desc->args_fmt);
             }
         }
+        led_fn_config(pfunc);
+        led_assert(!led.opt.output_match_all || led_fn_iszone(pfunc), LED_ERR_ARG, "Function %s does not apply on zones in all matches mode (-M)", pfn_desc->long_name);
+    }
+
+    // fuse the runs of per char functions in a single pass on the line, trims can only lead a run
+    led_fn_t* pfunc_head = NULL;
+    bool hasmap = false;
+    led_foreach_pval_len(led.func_list, led.func_count) {
+        led_fn_t* pfunc = foreach.pval;
+        led_fn_desc_t* pfn_desc = led_fn_table_descriptor(pfunc->id);
+        if (!led_fn_isfusable(pfunc))
+            pfunc_head = NULL;
+        else if (pfunc_head && !(pfn_desc->trim && hasmap)) {
+            pfunc_head->fused_count++;
+            pfunc->fused = true;
+            hasmap = hasmap || pfn_desc->map;
+            led_debug("led_init_config: function=%s fused with previous ones", pfn_desc->long_name);
+        }
+        else {
+            pfunc_head = pfunc;
+            hasmap = pfn_desc->map;
+        }
+    }
+
+    // pack mode blocks above the line size are streamed when no function needs the whole block
+    if (led.opt.pack_selected && !led.opt.exec && !(led.func_count == 0 && led.opt.output_match_all)) {
+        led.rope_stream = true;
+        led_foreach_pval_len(led.func_list, led.func_count)
+            led.rope_stream = led.rope_stream && led_fn_isstreamable(foreach.pval);
+        if (led.rope_stream)
+            led_foreach_int(led.func_count) {
+                led.stream[foreach.i].buf = led_arena_alloc(&led.arena, LED_ROPE_CHUNK + 1);
+                led_str_init(&led.stream[foreach.i].out, led_arena_alloc(&led.arena, LED_BUF_MAX + 1), LED_BUF_MAX + 1);
+            }
+        led_debug("led_init_config: rope stream=%d", led.rope_stream);
+    }
+
+    // the memo cache is useless on exec and wrong with functions keeping a state between lines
+    if (led.opt.memo && led.func_count > 0 && !led.opt.exec) {
+        bool pure = true;
+        led_foreach_pval_len(led.func_list, led.func_count)
+            pure = pure && led_fn_ispure(foreach.pval);
+        if (pure) led_memo_init(&led.memo);
+        led_debug("led_init_config: memo cache=%d", pure);
     }
 }
 
@@ -272,6 +336,7 @@ void led_init(size_t argc, char* argv[]) {
     led_debug("led_init:");
 
     led_regex_init();
+    led_str_codec_init();
 
     memset(&led, 0, sizeof(led));
 
@@ -310,13 +375,20 @@ void led_init(size_t argc, char* argv[]) {
     // if a process function is not defined show only selected
     led.opt.output_selected = led.opt.output_selected || led.func_count == 0;
 
+    // without function, all matches mode outputs the zones matching the selector
+    if (led.opt.output_match_all && led.sel.type_start == SEL_TYPE_REGEX)
+        led_str_match_iter_init(&led.sel.iter_start, led.sel.regex_start);
+
+    // without seed option, random values change on each run
+    led_rand_seed(&led.rand, led.opt.seeded ? led.opt.seed : (uint64_t)time(NULL) ^ (uint64_t)getpid() << 32);
+
     // init led_str_t file names with their buffers.
     led_str_init_buf(&led.file_in.name, led.file_in.buf_name);
     led_str_init_buf(&led.file_out.name, led.file_out.buf_name);
 
     led_line_reset(&led.line_read);
-    led_line_reset(&led.line_prep);
-    led_line_reset(&led.line_write);
+    led.line_prep = led_line_reset(&led.line_buf[0]);
+    led.line_write = led_line_reset(&led.line_buf[1]);
     led_foreach_int(LED_REG_MAX)
         led_line_reset(&led.line_reg[foreach.i]);
 
@@ -348,6 +420,7 @@ for simple automatic word processing based on PCRE2 modern regular expressions.\
     <n>     <regex_stop> => select group of lines starting line <n> (included) until matching <regex_stop> (excluded)\n\
     <n>     <count>      => select group of lines starting line <n> (included) until <count> lines are selected\n\
     +n      +n           => shift start/stop selector boundaries\n\
+    -n                   => shift start selector boundary before <regex> (n < 64)\n\
 \n\
 ## Processor:\n\
     <function>/ (processor with no argument)\n\
@@ -380,6 +453,10 @@ for simple automatic word processing based on PCRE2 modern regular expressions.\
 \n\
 ## Processor options\n\
     -m          output only processed maching zone when regex is used\n\
+    -M          output all processed maching zones one per line, or all selector matches without function\n\
+                only with zone functions, not with whole line ones (register, substitute, delete, dedup, sort, insert, append, range, join)\n\
+    -S<seed>    seed of randomize functions for reproducible values\n\
+    -c          cache the results of repeated lines, only with functions depending on the line alone\n\
 \n\
 ## Processor functions:\n\n\
 "
@@ -511,10 +588,16 @@ void led_file_stdout() {
     led_str_cpy_str(&led.file_out.name, "STDOUT");
 }
 
+void led_file_sort_flush() {
+    // the sorted lines go to the output before it is closed
+    led.report.line_write_count += led_sort_flush(&led.sort, led.file_out.file);
+}
+
 bool led_file_next() {
     led_debug("led_file_next: ---------------------------------------------------");
 
     if (led.opt.file_out && led.file_out.file && ! (led.opt.file_out == LED_OUTPUT_FILE_WRITE || led.opt.file_out == LED_OUTPUT_FILE_APPEND)) {
+        led_file_sort_flush();
         led_file_close_out();
         led_file_print_out();
     }
@@ -535,6 +618,7 @@ bool led_file_next() {
     }
 
     if (! led.file_in.file && led.file_out.file) {
+        led_file_sort_flush();
         led_file_close_out();
         led_file_print_out();
     }
@@ -542,6 +626,10 @@ bool led_file_next() {
     led_debug("led_file_next: input from=%s", led_str_str(&led.file_in.name));
     led_debug("led_file_next: output to=%s", led_str_str(&led.file_out.name));
 
+    led.file_in.block_start = 0;
+    led.file_in.block_stop = 0;
+    led.file_in.block_cut = '\0';
+
     led.sel.total_count = 0;
     led.sel.count = 0;
     led.sel.selected = false;
@@ -549,17 +637,100 @@ bool led_file_next() {
     return led.file_in.file != NULL;
 }
 
+char* led_file_read_line(size_t* plen, bool* pcut) {
+    for (;;) {
+        // restore the char cut by the previous too long line
+        if (led.file_in.block_cut) {
+            if (led.ring.count) led_ring_detach(&led.ring, led.file_in.buf_block, sizeof led.file_in.buf_block);
+            led.file_in.buf_block[led.file_in.block_start] = led.file_in.block_cut;
+            led.file_in.block_cut = '\0';
+        }
+        char* line = led.file_in.buf_block + led.file_in.block_start;
+        size_t avail = led.file_in.block_stop - led.file_in.block_start;
+        char* eol = memchr(line, '\n', avail < LED_BUF_MAX + 1 ? avail : LED_BUF_MAX + 1);
+        *pcut = false;
+        if (eol) {
+            *eol = '\0';
+            *plen = eol - line;
+            led.file_in.block_start += *plen + 1;
+            return line;
+        }
+        if (avail > LED_BUF_MAX) {
+            // line too long, cut it like fgets() does
+            *plen = LED_BUF_MAX;
+            *pcut = true;
+            led.file_in.block_start += LED_BUF_MAX;
+            led.file_in.block_cut = line[LED_BUF_MAX];
+            line[LED_BUF_MAX] = '\0';
+            return line;
+        }
+        // move the partial line at the block start and read more data
+        if (led.ring.count) led_ring_detach(&led.ring, led.file_in.buf_block, sizeof led.file_in.buf_block);
+        memmove(led.file_in.buf_block, line, avail);
+        led.file_in.block_start = 0;
+        led.file_in.block_stop = avail;
+        ssize_t count = read(fileno(led.file_in.file), led.file_in.buf_block + avail, LED_BLOCK_MAX - avail);
+        led_assert(count >= 0, LED_ERR_FILE, "File read error: %s", led_str_str(&led.file_in.name));
+        if (count == 0) {
+            // end of file, the last line may not have a newline
+            led.file_in.block_stop = 0;
+            if (avail == 0) return NULL;
+            led.file_in.buf_block[avail] = '\0';
+            *plen = avail;
+            return led.file_in.buf_block;
+        }
+        led.file_in.block_stop += count;
+    }
+}
+
+void led_process_read_ring() {
+    // the lines are read ahead of the selection by the negative shift
+    size_t len = 0;
+    bool cut = false;
+    char* line = NULL;
+    size_t missing = 0;
+    led.sel.start_ahead = false;
+    while (led.ring.count <= led.sel.lookback && (line = led_file_read_line(&len, &cut))) {
+        led_line_t* pline = led_ring_push(&led.ring);
+        led_str_init_view(&pline->lstr, line, len);
+        pline->cut = cut;
+        // a match starts the selection on the oldest line: the shifted one, or the first one with fewer lines before
+        if (led_str_match(&pline->lstr, led.sel.regex_start)) {
+            led.ring.start[led.ring.first] = true;
+            missing = led.sel.lookback + 1 - led.ring.count;
+        }
+    }
+    // at the end of file the lines left in the ring are selected without new start condition
+    if (led.ring.count) {
+        led.sel.start_ahead = led.ring.start[led.ring.first];
+        // like grep -B, the lines missing before the match reduce the selected count
+        led.sel.start_missing = missing;
+        if (led.sel.type_stop == SEL_TYPE_NONE ? missing > 0 : led.sel.type_stop == SEL_TYPE_COUNT && missing >= led.sel.val_stop)
+            led.sel.start_ahead = false;
+        led_line_view(&led.line_read, led_ring_pop(&led.ring));
+    }
+}
+
 bool led_process_read() {
     led_debug("led_process_read: ");
     if (!led_line_isinit(&led.line_read)) {
-        led_str_init(&led.line_read.lstr, fgets(led.line_read.buf, sizeof led.line_read.buf, led.file_in.file), sizeof led.line_read.buf);
+        if (led.sel.lookback)
+            led_process_read_ring();
+        else {
+            size_t len = 0;
+            bool cut = false;
+            char* line = led_file_read_line(&len, &cut);
+            led_str_init_view(&led.line_read.lstr, line, len);
+            led.line_read.cut = cut;
+        }
         if (led_line_isinit(&led.line_read)) {
-            led_str_trunk_uchar(&led.line_read.lstr, '\n');
             led.line_read.zone_start = 0;
             led.line_read.zone_stop = led.line_read.lstr.len;
             led.line_read.selected = false;
             led.sel.total_count++;
             led.report.line_read_count++;
+            if (led.opt.report && !led_str_isutf8(led.line_read.lstr.str, led.line_read.lstr.len))
+                led.report.line_invalid_count++;
             led_debug("led_process_read: read line num=%d len=%d", led.sel.total_count, led.line_read.lstr.len);
         }
         else
@@ -570,22 +741,25 @@ bool led_process_read() {
 
 void led_process_write() {
     led_debug("led_process_write: ");
-    if (led_line_isinit(&led.line_write)) {
-        led_debug("led_process_write: write line num=%d len=%d", led.sel.total_count, led_str_len(&led.line_write.lstr));
-        led_str_app_uchar(&led.line_write.lstr, '\n');
+    if (led_line_isinit(led.line_write)) {
+        led_debug("led_process_write: write line num=%d len=%d", led.sel.total_count, led_str_len(&led.line_write->lstr));
         led_debug("led_process_write: write line to file=%s", led_str_str(&led.file_out.name));
-        fwrite(led_str_str(&led.line_write.lstr), sizeof *led_str_str(&led.line_write.lstr), led_str_len(&led.line_write.lstr), led.file_out.file);
+        // the line can be a view on the input block, the newline is not appended to it
+        fwrite(led_str_str(&led.line_write->lstr), sizeof *led_str_str(&led.line_write->lstr), led_str_len(&led.line_write->lstr), led.file_out.file);
+        // the first part of a too long line is joined to the next part
+        if (!led.line_write->cut)
+            fputc('\n', led.file_out.file);
         fflush(led.file_out.file);
         led.report.line_write_count++;
     }
-    led_line_reset(&led.line_write);
+    led_line_reset(led.line_write);
 }
 
 void led_process_exec() {
     led_debug("led_process_exec: ");
-    if (led_line_isinit(&led.line_write) && !led_str_isblank(&led.line_write.lstr)) {
-        led_debug("led_process_exec: exec line num=%d len=%d command=%s", led.sel.total_count, led_str_len(&led.line_write.lstr), led_str_str(&led.line_write.lstr));
-        FILE *fp = popen(led_str_str(&led.line_write.lstr), "r");
+    if (led_line_isinit(led.line_write) && !led_str_isblank(&led.line_write->lstr)) {
+        led_debug("led_process_exec: exec line num=%d len=%d command=%s", led.sel.total_count, led_str_len(&led.line_write->lstr), led_str_str(&led.line_write->lstr));
+        FILE *fp = popen(led_str_str(&led.line_write->lstr), "r");
         led_assert(fp != NULL, LED_ERR_ARG, "Command error");
         led_str_decl(output, 4096);
         while (led_str_isinit(led_str_init(&output, fgets(led_str_str(&output), led_str_size(&output), fp), led_str_size(&output)))) {
@@ -594,7 +768,7 @@ void led_process_exec() {
         }
         pclose(fp);
     }
-    led_line_reset(&led.line_write);
+    led_line_reset(led.line_write);
 }
 
 bool led_process_selector() {
@@ -617,11 +791,11 @@ bool led_process_selector() {
     if (led_line_isinit(&led.line_read) && (
         led.sel.type_start == SEL_TYPE_NONE
         || (led.sel.type_start == SEL_TYPE_COUNT && led.sel.total_count == led.sel.val_start)
-        || (led.sel.type_start == SEL_TYPE_REGEX && led_str_match(&led.line_read.lstr, led.sel.regex_start))
+        || (led.sel.type_start == SEL_TYPE_REGEX && (led.sel.lookback ? led.sel.start_ahead : led_str_match(&led.line_read.lstr, led.sel.regex_start)))
         )) {
         led.sel.inboundary = true;
         led.sel.shift = led.sel.val_start;
-        led.sel.count = 0;
+        led.sel.count = led.sel.lookback ? led.sel.start_missing : 0;
         led_debug("led_process_selector: start selection");
     }
 
@@ -636,32 +810,46 @@ bool led_process_selector() {
         if (led_line_isselected(&led.line_read)) {
             led_debug("led_process_selector: pack: append to ready");
             if (!(led.opt.filter_blank && led_str_isblank(&led.line_read.lstr))) {
-                if (led_line_isinit(&led.line_prep)) {
-                    if (led_str_iscontent(&led.line_prep.lstr))
-                        led_str_app_uchar(&led.line_prep.lstr, '\n');
-                    led_str_app(&led.line_prep.lstr, &led.line_read.lstr);
+                // the next part of a too long line is appended without separator
+                bool issep = led_line_isinit(led.line_prep) && !led.line_prep->cut;
+                bool isfull = led_line_isinit(led.line_prep)
+                    && led_str_len(&led.line_prep->lstr) + issep + led_str_len(&led.line_read.lstr) > LED_BUF_MAX;
+                if (led_rope_len(&led.rope) || (isfull && led.rope_stream)) {
+                    // the block continues in the rope, from the line prep content
+                    if (!led_rope_len(&led.rope))
+                        led_rope_app(&led.rope, led_str_str(&led.line_prep->lstr), led_str_len(&led.line_prep->lstr));
+                    if (led_rope_len(&led.rope) && issep)
+                        led_rope_app(&led.rope, "\n", 1);
+                    led_rope_app(&led.rope, led_str_str(&led.line_read.lstr), led_str_len(&led.line_read.lstr));
+                }
+                else if (led_line_isinit(led.line_prep)) {
+                    if (isfull) led.report.line_truncated_count++;
+                    if (led_str_iscontent(&led.line_prep->lstr) && issep)
+                        led_str_app_uchar(&led.line_prep->lstr, '\n');
+                    led_str_app(&led.line_prep->lstr, &led.line_read.lstr);
                 }
                 else
-                    led_line_cpy(&led.line_prep, &led.line_read);
+                    led_line_cpy(led.line_prep, &led.line_read);
+                led.line_prep->cut = led.line_read.cut;
             }
-            led_line_select(&led.line_prep, true);
+            led_line_select(led.line_prep, true);
             led_line_reset(&led.line_read);
         }
-        else if (led_line_isselected(&led.line_prep)) {
+        else if (led_line_isselected(led.line_prep)) {
             led_debug("led_process_selector: pack: ready to process");
             ready = true;
         }
         else {
             led_debug("led_process_selector: pack: no selection");
             if (!(led.opt.filter_blank && led_str_isblank(&led.line_read.lstr)))
-                led_line_cpy(&led.line_prep, &led.line_read);
+                led_line_view(led.line_prep, &led.line_read);
             led_line_reset(&led.line_read);
             ready = true;
         }
     }
     else {
         if (!(led.opt.filter_blank && led_str_isblank(&led.line_read.lstr)))
-            led_line_cpy(&led.line_prep, &led.line_read);
+            led_line_view(led.line_prep, &led.line_read);
         led_line_reset(&led.line_read);
         ready = true;
     }
@@ -670,35 +858,173 @@ bool led_process_selector() {
     return ready;
 }
 
+void led_process_swap() {
+    // the line written by a function becomes the input of the next one without any copy
+    led_line_t* pline = led.line_prep;
+    led.line_prep = led.line_write;
+    led.line_write = pline;
+    led.line_prep->zone_start = 0;
+    led.line_prep->zone_stop = led_str_len(&led.line_prep->lstr);
+    led.line_prep->selected = led.line_write->selected;
+}
+
+void led_process_memo_recall(led_memo_entry_t* entry) {
+    // the result is a view on the cache slot, it is written before any other line is processed
+    if (entry->deleted)
+        led_line_reset(led.line_write);
+    else {
+        led_str_init_view(&led.line_write->lstr, entry->data + entry->klen, entry->vlen);
+        led.line_write->selected = true;
+    }
+    led.report.line_match_count += entry->match_count;
+    led.report.line_malformed_count += entry->malformed_count;
+}
+
+void led_process_stream_chunk(size_t ifunc, const char* str, size_t len, bool last) {
+    // the functions fused in a previous one are passed
+    while (ifunc < led.func_count && led.func_list[ifunc].fused) ifunc++;
+    if (ifunc == led.func_count) {
+        if (len) fwrite(str, 1, len, led.file_out.file);
+        return;
+    }
+    led_fn_t* pfunc = &led.func_list[ifunc];
+    led_fn_desc_t* pfn_desc = led_fn_table_descriptor(pfunc->id);
+    led_rope_stream_t* stream = &led.stream[ifunc];
+    do {
+        size_t n = len < LED_ROPE_CHUNK - stream->len ? len : LED_ROPE_CHUNK - stream->len;
+        if (n) memcpy(stream->buf + stream->len, str, n);
+        stream->len += n;
+        str += n;
+        len -= n;
+        bool end = last && !len;
+        // the chunk waits for more input until it is full
+        if (stream->len < LED_ROPE_CHUNK && !end) break;
+
+        size_t buf_len = stream->len;
+        size_t cut = end ? buf_len : led_fn_stream_cut(pfunc, stream->buf, &buf_len);
+        led_str_empty(&stream->out);
+        if (cut) {
+            // the chunk cut is given to the function as a line
+            char c = stream->buf[cut];
+            stream->buf[cut] = '\0';
+            led_str_init_view(&led.line_prep->lstr, stream->buf, cut);
+            led.line_prep->zone_start = 0;
+            led.line_prep->zone_stop = cut;
+            led.line_prep->selected = true;
+            if (pfunc->fused_count > 0)
+                led_fn_impl_fused(pfunc);
+            else {
+                (pfn_desc->impl)(pfunc);
+                while (led_zn_next(pfunc))
+                    (pfn_desc->impl)(pfunc);
+            }
+            stream->buf[cut] = c;
+            if (led_line_isinit(led.line_write)) led_str_cpy(&stream->out, &led.line_write->lstr);
+        }
+        stream->len = buf_len - cut;
+        memmove(stream->buf, stream->buf + cut, stream->len);
+        led_process_stream_chunk(ifunc + 1, led_str_str(&stream->out), led_str_len(&stream->out), end);
+    } while (len);
+}
+
+void led_process_stream() {
+    char buf[LED_ROPE_CHUNK];
+    size_t len = 0;
+    led_debug("led_process_stream: len=%lu spill=%lu", led_rope_len(&led.rope), led.rope.spill_len);
+    for (size_t offset = 0; offset < led_rope_len(&led.rope); offset += len) {
+        const char* chunk = led_rope_chunk(&led.rope, offset, &len, buf);
+        led_assert(len > 0, LED_ERR_FILE, "Rope temporary file read error");
+        led_process_stream_chunk(0, chunk, len, false);
+    }
+    led_process_stream_chunk(0, NULL, 0, true);
+    fputc('\n', led.file_out.file);
+    fflush(led.file_out.file);
+    led.report.line_match_count += led.func_count;
+    led.report.line_write_count++;
+    led_rope_reset(&led.rope);
+    led_line_reset(led.line_write);
+}
+
 void led_process_functions() {
-    led_debug("led_process_functions: Process line prep isinit=%d len=%d", led_line_isinit(&led.line_prep), led_str_len(&led.line_prep.lstr));
-    if (led_line_isinit(&led.line_prep)) {
+    led_debug("led_process_functions: Process line prep isinit=%d len=%d", led_line_isinit(led.line_prep), led_str_len(&led.line_prep->lstr));
+    if (led_rope_len(&led.rope)) {
+        led_process_stream();
+        led_line_reset(led.line_prep);
+        return;
+    }
+    bool cut = led.line_prep->cut;
+    if (led_line_isinit(led.line_prep)) {
         led_debug("led_process_functions: prep line is init");
-        if (led_line_isselected(&led.line_prep)) {
+        if (led_line_isselected(led.line_prep)) {
             led_debug("led_process_functions: prep line is selected");
-            if (led.func_count > 0) {
+            led_memo_entry_t* entry = NULL;
+            if (led.func_count > 0 && led.memo.entry)
+                entry = led_memo_get(&led.memo, led_str_str(&led.line_prep->lstr), led_str_len(&led.line_prep->lstr));
+            if (entry && entry->valid) {
+                led_debug("led_process_functions: memo hit len=%d", entry->vlen);
+                led_process_memo_recall(entry);
+            }
+            else if (led.func_count > 0) {
+                size_t match_count = led.report.line_match_count;
+                size_t malformed_count = led.report.line_malformed_count;
+                // the logfmt spans of the previous line are dropped, the new line can reuse its address
+                led.kv.str = NULL;
                 led_foreach_pval_len(led.func_list, led.func_count) {
                     led_fn_t* pfunc = foreach.pval;
                     led_fn_desc_t* pfn_desc = led_fn_table_descriptor(pfunc->id);
                     led.report.line_match_count++;
+                    // already processed in the single pass of a previous function
+                    if (pfunc->fused) continue;
+                    if (foreach.i > 0) led_process_swap();
+                    // the function rewrites the line write buffer, the logfmt spans read on it are dropped
+                    if (led.kv.str == led.line_write->buf) led.kv.str = NULL;
+                    if (pfunc->fused_count > 0) {
+                        led_debug("led_process_functions: call=%s fused with %d next", pfn_desc->long_name, pfunc->fused_count);
+                        led_fn_impl_fused(pfunc);
+                        continue;
+                    }
                     led_debug("led_process_functions: call=%s", pfn_desc->long_name);
                     (pfn_desc->impl)(pfunc);
-                    led_line_cpy(&led.line_prep, &led.line_write);
-                    led_debug("led_process_functions: result=\n%s", led_str_str(&led.line_write.lstr));
+                    while (led_zn_next(pfunc))
+                        (pfn_desc->impl)(pfunc);
+                    led_debug("led_process_functions: result=\n%s", led_str_str(&led.line_write->lstr));
+                    // the line has been deleted (delete, dedup, sort or no zone in all matches mode), no more function to apply
+                    if (!led_line_isinit(led.line_write)) break;
+                }
+                if (entry) {
+                    entry->match_count = led.report.line_match_count - match_count;
+                    entry->malformed_count = led.report.line_malformed_count - malformed_count;
+                    led_memo_set(&led.memo, entry, led_str_str(&led.line_write->lstr), led_str_len(&led.line_write->lstr), !led_line_isinit(led.line_write));
+                }
+            }
+            else if (led.opt.output_match_all && led.sel.type_start == SEL_TYPE_REGEX) {
+                led_debug("led_process_functions: no function, output selector matches");
+                led_line_init(led.line_write);
+                size_t count = 0;
+                led_str_match_iter_reset(&led.sel.iter_start);
+                while (led_str_match_iter_next(&led.sel.iter_start, &led.line_prep->lstr)) {
+                    // like grep -o, empty matches are not output
+                    if (led.sel.iter_start.zone_start == led.sel.iter_start.zone_stop) continue;
+                    if (count++ > 0)
+                        led_str_app_uchar(&led.line_write->lstr, '\n');
+                    led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.sel.iter_start.zone_start, led.sel.iter_start.zone_stop);
                 }
+                if (count == 0) led_line_reset(led.line_write);
             }
             else {
-                led_debug("led_process_functions: no function, copy len=%d", led_str_len(&led.line_prep.lstr));
-                led_line_cpy(&led.line_write, &led.line_prep);
+                led_debug("led_process_functions: no function, pass len=%d", led_str_len(&led.line_prep->lstr));
+                led_process_swap();
             }
         }
         else if (!led.opt.output_selected) {
-            led_debug("led_process_functions: copy unselected to dest");
-            led_line_cpy(&led.line_write, &led.line_prep);
+            led_debug("led_process_functions: pass unselected to dest");
+            led_process_swap();
         }
     }
-    led_debug("led_process_functions: result len=%d line=\n%s", led_str_len(&led.line_write.lstr), led_str_str(&led.line_write.lstr));
-    led_line_reset(&led.line_prep);
+    led_debug("led_process_functions: result len=%d line=\n%s", led_str_len(&led.line_write->lstr), led_str_str(&led.line_write->lstr));
+    // the functions output of a line part is joined to the next part as the input
+    led.line_write->cut = cut;
+    led_line_reset(led.line_prep);
 }
 
 void led_report() {
@@ -706,6 +1032,17 @@ void led_report() {
     fprintf(stderr, "line_read_count:\t%ld\n", led.report.line_read_count);
     fprintf(stderr, "line_match_count:\t%ld\n", led.report.line_match_count);
     fprintf(stderr, "line_write_count:\t%ld\n", led.report.line_write_count);
+    fprintf(stderr, "line_invalid_count:\t%ld\n", led.report.line_invalid_count);
+    fprintf(stderr, "line_malformed_count:\t%ld\n", led.report.line_malformed_count);
+    fprintf(stderr, "line_dedup_count:\t%ld\n", led.report.line_dedup_count);
+    fprintf(stderr, "line_truncated_count:\t%ld\n", led.report.line_truncated_count);
+    fprintf(stderr, "dedup_memory:\t%ld\n", led_dedup_memory(&led.dedup));
+    fprintf(stderr, "dedup_evict_count:\t%ld\n", led.dedup.evict_count);
+    fprintf(stderr, "path_cache_hit_count:\t%ld\n", led.report.path_cache_hit_count);
+    fprintf(stderr, "path_cache_miss_count:\t%ld\n", led.report.path_cache_miss_count);
+    fprintf(stderr, "memo_hit_count:\t%ld\n", led.memo.hit_count);
+    fprintf(stderr, "memo_miss_count:\t%ld\n", led.memo.miss_count);
+    fprintf(stderr, "memo_hit_rate:\t%.1f%%\n", led.memo.hit_count + led.memo.miss_count ? 100.0 * led.memo.hit_count / (led.memo.hit_count + led.memo.miss_count) : 0.0);
     fprintf(stderr, "file_input_count:\t%ld\n", led.report.file_in_count);
     fprintf(stderr, "file_output_count:\t%ld\n", led.report.file_out_count);
     fprintf(stderr, "file_match_count:\t%ld\n", led.report.file_match_count);
@@ -17,16 +17,17 @@
  USA
  ***************************************************************************/
 
+#define _GNU_SOURCE
 #include <limits.h>
 #include <unistd.h>
 #include <string.h>
-#include <ctype.h>
 #include <locale.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdio.h>
-#include <libgen.h>
+#include <sys/stat.h>
 #include <stdbool.h>
+#include <time.h>
 
 #ifdef WIN32
 #define realpath(N,R) _fullpath((R),(N),PATH_MAX)
@@ -99,7 +100,11 @@ inline char led_uchar_to_char(led_uchar_t uc) {
 }
 
 inline size_t led_uchar_size_str(const char* str) {
-    return led_uchar_size_table[(((uint8_t *)(str))[0] & 0xFF) >> 4];
+    size_t usize = led_uchar_size_table[(((uint8_t *)(str))[0] & 0xFF) >> 4];
+    // invalid UTF-8: a lead byte without all its continuation bytes is a single byte char
+    for (size_t i = 1; i < usize; i++)
+        if ((str[i] & 0xC0) != 0x80) return 1;
+    return usize;
 }
 
 inline size_t led_uchar_size(led_uchar_t uc) {
@@ -115,30 +120,77 @@ inline size_t led_uchar_pos_next(const char* str, size_t idx) {
 }
 
 inline size_t led_uchar_pos_prev(const char* str, size_t idx) {
-    if (idx)
-        for (idx--; idx && led_uchar_iscont(str[idx]); idx--);
+    if (idx) {
+        size_t i = idx - 1;
+        for (; i && idx - i < 4 && led_uchar_iscont(str[i]); i--);
+        // the sequence found must end at idx, or the previous byte is an invalid single byte char
+        idx = i + led_uchar_size_str(str + i) == idx ? i : idx - 1;
+    }
     return idx;
 }
 
+// end of a chunk not splitting a char: a lead byte waiting for its continuation bytes is left out
+inline size_t led_uchar_pos_cut(const char* str, size_t len) {
+    for (size_t i = len; i > 0 && len - i < 4; i--)
+        if (!led_uchar_iscont(str[i-1]))
+            return len - (i - 1) < led_uchar_size_table[(uint8_t)str[i-1] >> 4] ? i - 1 : len;
+    return len;
+}
+
+// ASCII chars classes, locale independent: multi-bytes chars have no class
+#define LED_UCHAR_CLASS_DIGIT 0x01
+#define LED_UCHAR_CLASS_UPPER 0x02
+#define LED_UCHAR_CLASS_LOWER 0x04
+#define LED_UCHAR_CLASS_SPACE 0x08
+#define LED_UCHAR_CLASS_ALNUM (LED_UCHAR_CLASS_DIGIT|LED_UCHAR_CLASS_UPPER|LED_UCHAR_CLASS_LOWER)
+
+extern const uint8_t led_uchar_class_table[];
+
+inline bool led_uchar_isclass(led_uchar_t uc, uint8_t uclass) {
+    return uc < 0x80 && (led_uchar_class_table[uc] & uclass);
+}
+
 inline bool led_uchar_isalnum(led_uchar_t uc) {
-    return isalnum(led_uchar_to_char(uc));
+    return led_uchar_isclass(uc, LED_UCHAR_CLASS_ALNUM);
 }
 
 inline bool led_uchar_isdigit(led_uchar_t uc) {
-    return isdigit(led_uchar_to_char(uc));
+    return led_uchar_isclass(uc, LED_UCHAR_CLASS_DIGIT);
 }
 
 inline bool led_uchar_isspace(led_uchar_t uc) {
-    return isspace(led_uchar_to_char(uc));
+    return led_uchar_isclass(uc, LED_UCHAR_CLASS_SPACE);
+}
+
+// Unicode simple case mapping tables (led_ucase.c) on packed UTF-8 chars:
+// the codepoint without its 6 low bits gives the block, the 6 low bits the char in the block.
+extern const size_t led_ucase_stage1_size;
+extern const uint8_t led_ucase_stage1[];
+extern const led_uchar_t led_ucase_lower[][64];
+extern const led_uchar_t led_ucase_upper[][64];
+
+inline size_t led_uchar_case_block(led_uchar_t uc) {
+    if (uc < 0x10000) return (uc >> 8) & 0x1F;
+    if (uc < 0x1000000) return ((uc >> 16) & 0x0F) << 6 | ((uc >> 8) & 0x3F);
+    return ((uc >> 24) & 0x07) << 12 | ((uc >> 16) & 0x3F) << 6 | ((uc >> 8) & 0x3F);
+}
+
+inline led_uchar_t led_uchar_case_map(const led_uchar_t table[][64], led_uchar_t uc) {
+    // single invalid bytes have no case
+    if (uc < 0x100) return uc;
+    size_t ib = led_uchar_case_block(uc);
+    if (ib >= led_ucase_stage1_size) return uc;
+    led_uchar_t ucm = table[led_ucase_stage1[ib]][uc & 0x3F];
+    return ucm ? ucm : uc;
 }
 
 inline led_uchar_t led_uchar_tolower(led_uchar_t uc) {
-    if (uc >= 'A' && uc <= 'Z') uc = tolower(led_uchar_to_char(uc));
-    return uc;
+    if (uc < 0x80) return led_uchar_isclass(uc, LED_UCHAR_CLASS_UPPER) ? uc ^ 0x20 : uc;
+    return led_uchar_case_map(led_ucase_lower, uc);
 }
 inline led_uchar_t led_uchar_toupper(led_uchar_t uc) {
-    if (uc >= 'a' && uc <= 'z') uc = toupper(led_uchar_to_char(uc));
-    return uc;
+    if (uc < 0x80) return led_uchar_isclass(uc, LED_UCHAR_CLASS_LOWER) ? uc ^ 0x20 : uc;
+    return led_uchar_case_map(led_ucase_upper, uc);
 }
 
 size_t led_uchar_to_str(char* str, led_uchar_t uc);
@@ -156,10 +208,12 @@ inline bool led_uchar_in_str(led_uchar_t uc, const char* str) {
     return false;
 }
 
-/* codepoints UFT-8 functions are not necessary but we let it if needed.
-
 bool led_uchar_isvalid(led_uchar_t uc);
+
 led_uchar_t led_uchar_encode(uint32_t code);
+
+/* codepoints UFT-8 functions are not necessary but we let it if needed.
+
 uint32_t led_uchar_decode(led_uchar_t uc);
 
 */
@@ -251,6 +305,14 @@ inline led_str_t* led_str_reset(led_str_t* lstr) {
 
 led_str_t* led_str_init(led_str_t* lstr, char* buf, size_t size);
 
+// init a string as a view on a buffer part of a known length, the buffer must be terminated at len.
+inline led_str_t* led_str_init_view(led_str_t* lstr, char* str, size_t len) {
+    lstr->str = str;
+    lstr->len = str ? len : 0;
+    lstr->size = str ? len + 1 : 0;
+    return lstr;
+}
+
 inline led_str_t* led_str_empty(led_str_t* lstr) {
     lstr->str[0] = '\0';
     lstr->len = 0;
@@ -264,9 +326,9 @@ inline led_str_t* led_str_clone(led_str_t* lstr, led_str_t* lstr_src) {
     return lstr;
 }
 
-inline led_str_t* led_str_cpy(led_str_t* lstr, led_str_t* lstr_src) {
+inline led_str_t* led_str_cpy_str(led_str_t* lstr, const char* str) {
     lstr->len = 0;
-    led_str_foreach_char(lstr_src)
+    led_foreach_char(str)
         if (lstr->len+1 < lstr->size )
             lstr->str[lstr->len++] = foreach.c;
         else break;
@@ -274,36 +336,29 @@ inline led_str_t* led_str_cpy(led_str_t* lstr, led_str_t* lstr_src) {
     return lstr;
 }
 
-inline led_str_t* led_str_cpy_str(led_str_t* lstr, const char* str) {
-    lstr->len = 0;
-    led_foreach_char(str)
-        if (lstr->len+1 < lstr->size )
-            lstr->str[lstr->len++] = foreach.c;
-        else break;
+inline led_str_t* led_str_app_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    if (start < stop) {
+        size_t len = stop - start;
+        if (lstr->len + len >= lstr->size)
+            len = lstr->size > lstr->len ? lstr->size - lstr->len - 1 : 0;
+        memcpy(lstr->str + lstr->len, lstr_src->str + start, len);
+        lstr->len += len;
+    }
     lstr->str[lstr->len] = '\0';
     return lstr;
 }
 
 inline led_str_t* led_str_app(led_str_t* lstr, led_str_t* lstr_src) {
-    led_str_foreach_char(lstr_src)
-        if (lstr->len+1 < lstr->size )
-            lstr->str[lstr->len++] = foreach.c;
-        else break;
-    lstr->str[lstr->len] = '\0';
-    return lstr;
+    return led_str_app_zn(lstr, lstr_src, 0, lstr_src->len);
 }
 
-inline led_str_t* led_str_app_str(led_str_t* lstr, const char* str) {
-    led_foreach_char(str)
-        if (lstr->len+1 < lstr->size )
-            lstr->str[lstr->len++] = foreach.c;
-        else break;
-    lstr->str[lstr->len] = '\0';
-    return lstr;
+inline led_str_t* led_str_cpy(led_str_t* lstr, led_str_t* lstr_src) {
+    lstr->len = 0;
+    return led_str_app(lstr, lstr_src);
 }
 
-inline led_str_t* led_str_app_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
-    led_str_foreach_char_zn(lstr_src, start, stop)
+inline led_str_t* led_str_app_str(led_str_t* lstr, const char* str) {
+    led_foreach_char(str)
         if (lstr->len+1 < lstr->size )
             lstr->str[lstr->len++] = foreach.c;
         else break;
@@ -353,14 +408,14 @@ inline led_str_t* led_str_trunk_end(led_str_t* lstr, size_t len) {
 }
 
 inline led_str_t* led_str_rtrim(led_str_t* lstr) {
-    while (lstr->len > 0 && isspace(lstr->str[lstr->len-1])) lstr->len--;
+    while (lstr->len > 0 && led_uchar_isspace((uint8_t)lstr->str[lstr->len-1])) lstr->len--;
     lstr->str[lstr->len] = '\0';
     return lstr;
 }
 
 inline led_str_t* led_str_ltrim(led_str_t* lstr) {
     size_t i=0,j=0;
-    for (; i < lstr->len && isspace(lstr->str[i]); i++);
+    for (; i < lstr->len && led_uchar_isspace((uint8_t)lstr->str[i]); i++);
     for (; i < lstr->len; i++,j++) lstr->str[j] = lstr->str[i];
     lstr->len = j;
     lstr->str[lstr->len] = '\0';
@@ -374,7 +429,6 @@ inline led_str_t* led_str_trim(led_str_t* lstr) {
 led_str_t* led_str_cut_next(led_str_t* lstr, led_uchar_t uc, led_str_t* stok);
 
 inline led_uchar_t led_str_uchar_at(led_str_t* lstr, size_t idx) {
-    if (led_uchar_iscont(lstr->str[idx])) return '\0';
     led_uchar_t uc;
     led_uchar_from_str(lstr->str + idx, &uc);
     return uc;
@@ -512,20 +566,180 @@ inline size_t led_str_find_str(led_str_t* lstr, const char* str_sub) {
     return lstr->len;
 }
 
+// POSIX basename and dirname on a zone, the result is a zone of the same string.
+// An empty result zone stands for ".", the root is kept as a zone of the leading slashes.
+inline size_t led_str_basename_zn(led_str_t* lstr, size_t start, size_t* stop) {
+    size_t i = *stop;
+    while (i > start && lstr->str[i-1] == '/') i--;
+    if (i == start) {
+        if (*stop > start) *stop = start + 1;
+        return start;
+    }
+    *stop = i;
+    while (i > start && lstr->str[i-1] != '/') i--;
+    return i;
+}
+
+inline size_t led_str_dirname_zn(led_str_t* lstr, size_t start, size_t stop) {
+    size_t i = stop;
+    while (i > start && lstr->str[i-1] == '/') i--;
+    while (i > start && lstr->str[i-1] != '/') i--;
+    while (i > start && lstr->str[i-1] == '/') i--;
+    if (i > start) return i;
+    if (start == stop || lstr->str[start] != '/') return start;
+    // only "//" is kept apart from the root
+    for (i = start; i < stop && lstr->str[i] == '/'; i++);
+    return start + (i - start == 2 ? 2 : 1);
+}
+
 inline led_str_t* led_str_basename(led_str_t* lstr) {
-    lstr->str = basename(lstr->str);
-    lstr->len = strlen(lstr->str);
-    lstr->size = lstr->len + 1;
-    return lstr;
+    size_t stop = lstr->len;
+    size_t start = led_str_basename_zn(lstr, 0, &stop);
+    if (start == stop) return led_str_init_str(lstr, ".");
+    lstr->str[stop] = '\0';
+    return led_str_init_view(lstr, lstr->str + start, stop - start);
 }
 
 inline led_str_t* led_str_dirname(led_str_t* lstr) {
-    lstr->str = basename(lstr->str);
-    lstr->len = strlen(lstr->str);
-    lstr->size = lstr->len + 1;
-    return lstr;
+    size_t stop = led_str_dirname_zn(lstr, 0, lstr->len);
+    if (!stop) return led_str_init_str(lstr, ".");
+    lstr->str[stop] = '\0';
+    return led_str_init_view(lstr, lstr->str, stop);
+}
+
+//-----------------------------------------------
+// LED string scans by blocks (SSE2 when available)
+// Invalid UTF-8 bytes are single byte chars passed unchanged.
+//-----------------------------------------------
+
+size_t led_str_ascii_span(const char* str, size_t len);
+bool led_str_isutf8(const char* str, size_t len);
+size_t led_str_uchar_count(const char* str, size_t len);
+size_t led_str_pos_uchar_n(const char* str, size_t len, size_t n);
+size_t led_str_find_csv(const char* str, size_t len, char sep, bool* quoted);
+led_str_t* led_str_app_lower_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+led_str_t* led_str_app_upper_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+
+//-----------------------------------------------
+// LED uchar map: direct table for ASCII, open addressing hash for multi-bytes chars
+//-----------------------------------------------
+
+#define LED_UCHAR_MAP_BITS 8
+#define LED_UCHAR_MAP_HASH (1 << LED_UCHAR_MAP_BITS)
+
+typedef struct {
+    led_uchar_t ascii[0x80];
+    struct {
+        led_uchar_t key;
+        led_uchar_t val;
+    } hash[LED_UCHAR_MAP_HASH];
+    size_t hash_count;
+    // all ASCII chars are mapped to ASCII chars, allows bytes processing
+    bool ascii_only;
+} led_uchar_map_t;
+
+void led_uchar_map_init(led_uchar_map_t* map);
+void led_uchar_map_set(led_uchar_map_t* map, led_uchar_t uc, led_uchar_t uc_val);
+led_str_t* led_str_app_map_zn(led_str_t* lstr, led_str_t* lstr_src, led_uchar_map_t* map, size_t start, size_t stop);
+
+inline size_t led_uchar_map_pos(led_uchar_t uc) {
+    return (uint32_t)(uc * 0x9E3779B1u) >> (32 - LED_UCHAR_MAP_BITS);
+}
+
+inline led_uchar_t led_uchar_map_get(led_uchar_map_t* map, led_uchar_t uc) {
+    if (uc < 0x80) return map->ascii[uc];
+    // the hash is never full, an empty slot ends the search
+    for (size_t i = led_uchar_map_pos(uc); map->hash[i].key; i = (i + 1) & (LED_UCHAR_MAP_HASH - 1))
+        if (map->hash[i].key == uc) return map->hash[i].val;
+    return uc;
 }
 
+//-----------------------------------------------
+// LED uchar set: byte class for ASCII, short list of multi-bytes chars
+//-----------------------------------------------
+
+#define LED_UCHAR_SET_MB_MAX 16
+#define LED_UCHAR_SET_SCAN_MAX 8
+
+typedef struct {
+    bool ascii[0x80];
+    led_uchar_t mb[LED_UCHAR_SET_MB_MAX];
+    size_t mb_count;
+    // ASCII chars compared by blocks when not too many
+    char scan[LED_UCHAR_SET_SCAN_MAX];
+    size_t scan_count;
+} led_uchar_set_t;
+
+void led_uchar_set_init(led_uchar_set_t* set, const char* str);
+size_t led_str_find_set(const char* str, size_t len, led_uchar_set_t* set);
+size_t led_str_span_set(const char* str, size_t len, led_uchar_set_t* set);
+
+inline bool led_uchar_set_has(led_uchar_set_t* set, led_uchar_t uc) {
+    if (uc < 0x80) return set->ascii[uc];
+    led_foreach_int(set->mb_count)
+        if (set->mb[foreach.i] == uc) return true;
+    return false;
+}
+
+//-----------------------------------------------
+// LED byte class: table of the safe bytes, alnum and a few extra chars compared by blocks
+//-----------------------------------------------
+
+#define LED_BYTE_CLASS_EXTRA_MAX 8
+
+typedef struct {
+    bool byte[0x100];
+    char extra[LED_BYTE_CLASS_EXTRA_MAX];
+    size_t extra_count;
+} led_byte_class_t;
+
+extern const led_byte_class_t led_byte_class_url;
+extern const led_byte_class_t led_byte_class_shell;
+
+size_t led_str_span_class(const char* str, size_t len, const led_byte_class_t* bclass);
+
+//-----------------------------------------------
+// LED json scanner: key path of object keys and array indexes separated by dots
+//-----------------------------------------------
+
+bool led_json_find(const char* str, size_t len, const char* path, size_t* pstart, size_t* pstop);
+led_str_t* led_str_app_json_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+
+//-----------------------------------------------
+// LED logfmt tokenizer: key=value or key="quoted value" separated by spaces
+//-----------------------------------------------
+
+#define LED_KV_MAX 64
+
+typedef struct {
+    size_t kstart;
+    size_t kstop;
+    size_t vstart;
+    size_t vstop;
+} led_kv_span_t;
+
+size_t led_logfmt_split(const char* str, size_t len, led_kv_span_t* span, size_t max);
+
+//-----------------------------------------------
+// LED base64, hex and url codecs
+//-----------------------------------------------
+
+// SSSE3 paths selected at runtime when available
+extern bool led_str_base64_hw;
+
+void led_str_codec_init();
+led_str_t* led_str_app_base64_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop, bool url);
+led_str_t* led_str_app_unbase64_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+led_str_t* led_str_app_hex_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+led_str_t* led_str_app_unhex_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+uint8_t led_hex_val(uint8_t c);
+// end of a chunk on the last complete base64 quad or hex pair, the chars of the incomplete one
+// are compacted after the cut and the len is updated
+size_t led_str_unbase64_cut(char* str, size_t* len);
+size_t led_str_unhex_cut(char* str, size_t* len);
+led_str_t* led_str_app_url_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+led_str_t* led_str_app_unurl_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop);
+
 //-----------------------------------------------
 // LED string pcre management
 //-----------------------------------------------
@@ -549,6 +763,28 @@ pcre2_code* led_regex_compile(const char* pat, size_t opt);
 bool led_str_match(led_str_t* lstr, pcre2_code* regex);
 bool led_str_match_offset(led_str_t* lstr, pcre2_code* regex, size_t* pzone_start, size_t* pzone_stop);
 
+// match iterator: the match data is allocated once and reused for all the matches of all the lines.
+typedef struct {
+    pcre2_code* regex;
+    pcre2_match_data* match_data;
+    PCRE2_SIZE* ovector;
+    size_t offset;
+    uint32_t opts;
+    size_t zone_start;
+    size_t zone_stop;
+} led_str_match_iter_t;
+
+void led_str_match_iter_init(led_str_match_iter_t* iter, pcre2_code* regex);
+void led_str_match_iter_free(led_str_match_iter_t* iter);
+bool led_str_match_iter_next(led_str_match_iter_t* iter, led_str_t* lstr);
+
+inline led_str_match_iter_t* led_str_match_iter_reset(led_str_match_iter_t* iter) {
+    iter->offset = 0;
+    iter->opts = 0;
+    iter->zone_start = iter->zone_stop = 0;
+    return iter;
+}
+
 inline pcre2_code* led_str_regex_compile(led_str_t* pat, size_t opt) {
     return led_regex_compile(pat->str, opt);
 }
@@ -562,16 +798,239 @@ inline bool led_str_isblank(led_str_t* lstr) {
     return led_str_match(lstr, LED_REGEX_BLANK_LINE) > 0;
 }
 
+//-----------------------------------------------
+// LED hash functions (led_hash.c), hardware paths selected at runtime
+//-----------------------------------------------
+
+extern bool led_hash_crc32c_hw;
+extern bool led_hash_sha256_hw;
+
+void led_hash_init();
+uint32_t led_hash_crc32c(const void* data, size_t len);
+uint64_t led_hash_xxh64(const void* data, size_t len, uint64_t seed);
+void led_hash_sha256(const void* data, size_t len, uint8_t* digest);
+
+// dedup set: open addressing on 64 bits fingerprints, 0 is the empty slot.
+// The table of size s is at offset s of a reserved region, pages are touched on use only.
+#define LED_DEDUP_MIN 0x1000
+#define LED_DEDUP_MAX 0x1000000
+#define LED_DEDUP_PROBE 32
+#define LED_DEDUP_ARENA_MAX 0x10000000
+
+typedef struct {
+    uint64_t* fp;
+    // exact compare: key offsets in the arena of length prefixed keys
+    uint32_t* off;
+    char* arena;
+    size_t arena_len;
+    size_t size;
+    size_t size_max;
+    size_t count;
+    size_t evict_count;
+    bool exact;
+} led_dedup_t;
+
+void led_dedup_init(led_dedup_t* set, bool exact, size_t size_max);
+bool led_dedup_add(led_dedup_t* set, const char* key, size_t len, uint64_t seed);
+size_t led_dedup_memory(led_dedup_t* set);
+void led_dedup_free(led_dedup_t* set);
+
+// memo cache: LRU of the function chain results keyed by the line hash.
+// A slot keeps the line and its result, longer ones are not kept.
+#define LED_MEMO_MAX 0x1000
+#define LED_MEMO_DATA_MAX 0x3E0
+
+typedef struct {
+    uint64_t hash;
+    // bucket chain and LRU list: index + 1, 0 ends
+    uint32_t chain;
+    uint32_t prev;
+    uint32_t next;
+    uint16_t klen;
+    uint16_t vlen;
+    bool valid;
+    bool deleted;
+    // report counts of the chain to replay
+    uint8_t match_count;
+    uint8_t malformed_count;
+    char data[LED_MEMO_DATA_MAX];
+} led_memo_entry_t;
+
+typedef struct {
+    led_memo_entry_t* entry;
+    uint32_t* bucket;
+    size_t count;
+    uint32_t head;
+    uint32_t tail;
+    size_t hit_count;
+    size_t miss_count;
+} led_memo_t;
+
+void led_memo_init(led_memo_t* memo);
+// a hit is a valid entry, a miss gives a new entry with the key to set after the chain
+led_memo_entry_t* led_memo_get(led_memo_t* memo, const char* key, size_t len);
+void led_memo_set(led_memo_t* memo, led_memo_entry_t* entry, const char* val, size_t len, bool deleted);
+void led_memo_free(led_memo_t* memo);
+
+//-----------------------------------------------
+// LED sort stage (led_sort.c): radix sort in a memory budget, sorted runs spilled
+// to temporary files and merged
+//-----------------------------------------------
+
+#define LED_SORT_MEM_MIN 0x400000
+#define LED_SORT_MEM_DEFAULT 0x4000000
+#define LED_SORT_RUN_MAX 64
+#define LED_SORT_LEVEL_MAX 8
+
+// the prefix gives the order of the first 8 key bytes or of the numeric key
+typedef struct {
+    uint64_t prefix;
+    uint32_t off;
+    uint32_t len;
+    uint32_t kstart;
+    uint32_t klen;
+} led_sort_rec_t;
+
+typedef struct {
+    // reserved memory: records from the start, lines from the end
+    char* mem;
+    size_t mem_size;
+    size_t count;
+    size_t data_len;
+    // runs by age, a run of level k+1 is the merge of LED_SORT_RUN_MAX runs of level k
+    FILE* run[LED_SORT_RUN_MAX * LED_SORT_LEVEL_MAX];
+    size_t run_level[LED_SORT_RUN_MAX * LED_SORT_LEVEL_MAX];
+    size_t run_count;
+    size_t spill_count;
+    bool numeric;
+    bool reverse;
+} led_sort_t;
+
+void led_sort_init(led_sort_t* sort, size_t mem_size, bool numeric, bool reverse);
+void led_sort_add(led_sort_t* sort, const char* line, size_t len, size_t kstart, size_t kstop);
+size_t led_sort_flush(led_sort_t* sort, FILE* file);
+void led_sort_free(led_sort_t* sort);
+
+//-----------------------------------------------
+// LED rope (led_rope.c): pack mode blocks above the line size, appended to reserved memory
+// up to a budget then to a temporary file, and read back by chunks
+//-----------------------------------------------
+
+#define LED_ROPE_MEM_MAX 0x4000000
+// a quarter of the line size: a function writes at most 4 bytes by byte read
+#define LED_ROPE_CHUNK 0x2000
+
+typedef struct {
+    char* mem;
+    size_t mem_len;
+    FILE* spill;
+    size_t spill_len;
+} led_rope_t;
+
+inline size_t led_rope_len(led_rope_t* rope) {
+    return rope->mem_len + rope->spill_len;
+}
+
+// chunk of a function input waiting for a cut, and the function output
+typedef struct {
+    char* buf;
+    size_t len;
+    led_str_t out;
+} led_rope_stream_t;
+
+void led_rope_app(led_rope_t* rope, const char* str, size_t len);
+const char* led_rope_chunk(led_rope_t* rope, size_t offset, size_t* len, char* buf);
+void led_rope_reset(led_rope_t* rope);
+void led_rope_free(led_rope_t* rope);
+
+//-----------------------------------------------
+// LED AES-256-GCM (led_aes.c), AES-NI and PCLMUL selected at runtime, constant time software fallback
+//-----------------------------------------------
+
+#define LED_AES_KEY_LEN 32
+#define LED_AES_IV_LEN 12
+#define LED_AES_TAG_LEN 16
+
+typedef struct {
+    // expanded round keys, GHASH key and next nonce to use in encryption
+    uint8_t rk[15*16];
+    uint8_t h[16];
+    uint8_t nonce[LED_AES_IV_LEN];
+    bool hw;
+} led_aes_t;
+
+typedef struct {
+    const led_aes_t* aes;
+    uint8_t j0[16];
+    uint8_t x[16];
+    uint32_t ctr;
+    size_t len;
+} led_aes_gcm_t;
+
+void led_aes_init(led_aes_t* aes, const uint8_t* key);
+void led_aes_encrypt_block(const uint8_t* rk, const uint8_t* in, uint8_t* out);
+void led_aes_nonce(led_aes_t* aes, uint8_t* iv);
+void led_aes_gcm_start(led_aes_gcm_t* gcm, const led_aes_t* aes, const uint8_t* iv);
+// crypt in place, the length must be a multiple of 16 except on the last call
+void led_aes_gcm_crypt(led_aes_gcm_t* gcm, uint8_t* data, size_t len, bool encrypt);
+void led_aes_gcm_finish(led_aes_gcm_t* gcm, uint8_t* tag);
+
+//-----------------------------------------------
+// LED random generator: wyrand, the state is given to be kept per thread
+//-----------------------------------------------
+
+typedef struct {
+    uint64_t state;
+    // random bytes not used yet of the last value
+    uint64_t bytes;
+    size_t byte_count;
+} led_rand_t;
+
+inline void led_rand_seed(led_rand_t* rand, uint64_t seed) {
+    rand->state = seed;
+    rand->byte_count = 0;
+}
+
+inline uint64_t led_rand_next(led_rand_t* rand) {
+    rand->state += 0xa0761d6478bd642fULL;
+    __uint128_t t = (__uint128_t)rand->state * (rand->state ^ 0xe7037ed1a0b428dbULL);
+    return (uint64_t)(t >> 64) ^ (uint64_t)t;
+}
+
+inline uint8_t led_rand_byte(led_rand_t* rand) {
+    if (rand->byte_count == 0) {
+        rand->bytes = led_rand_next(rand);
+        rand->byte_count = 8;
+    }
+    uint8_t b = rand->bytes;
+    rand->bytes >>= 8;
+    rand->byte_count--;
+    return b;
+}
+
+inline size_t led_rand_index(led_rand_t* rand, size_t n) {
+    // n is at most 256, the bytes over the last multiple of n are rejected to avoid the modulo bias
+    size_t limit = 256 - 256 % n;
+    for (;;) {
+        uint8_t b = led_rand_byte(rand);
+        if (b < limit) return b % n;
+    }
+}
+
 //-----------------------------------------------
 // LED constants
 //-----------------------------------------------
 
 #define LED_BUF_MAX 0x8000
+#define LED_BLOCK_MAX 0x20000
 #define LED_FARG_MAX 3
 #define LED_SEL_MAX 2
 #define LED_FUNC_MAX 16
 #define LED_FNAME_MAX 0x1000
+#define LED_PATH_CACHE_MAX 64
 #define LED_REG_MAX 10
+#define LED_FRANGE_MAX 16
+#define LED_FIELD_MAX 1024
 
 #define SEL_TYPE_NONE 0
 #define SEL_TYPE_REGEX 1
@@ -599,34 +1058,65 @@ inline bool led_str_isblank(led_str_t* lstr) {
 // LED line management
 //-----------------------------------------------
 
+// the line string is either in the line buffer or a view on another buffer (input block or line)
+// until a function writes it. The buffer is taken from the arena on the first write.
 typedef struct {
     led_str_t lstr;
-    char buf[LED_BUF_MAX+1];
     size_t zone_start;
     size_t zone_stop;
     bool selected;
+    // first part of a too long line split by the block reader, joined to the next part on output
+    bool cut;
+    char* buf;
 } led_line_t;
 
+char* led_line_buf_alloc();
+
+inline char* led_line_buf(led_line_t* pline) {
+    if (!pline->buf) pline->buf = led_line_buf_alloc();
+    return pline->buf;
+}
+
+inline led_str_t* led_line_str_init(led_line_t* pline) {
+    return led_str_init(&pline->lstr, led_line_buf(pline), LED_BUF_MAX+1);
+}
+
+// reset and init only touch the line header, the buffer content is never cleared.
 inline led_line_t* led_line_reset(led_line_t* pline) {
-    memset(pline, 0, sizeof *pline);
+    led_str_reset(&pline->lstr);
+    pline->zone_start = 0;
+    pline->zone_stop = 0;
+    pline->selected = false;
+    pline->cut = false;
     return pline;
 }
 
 inline led_line_t* led_line_init(led_line_t* pline) {
     led_line_reset(pline);
-    led_str_init_buf(&pline->lstr, pline->buf);
+    led_line_buf(pline)[0] = '\0';
+    led_line_str_init(pline);
     return pline;
 }
 
 inline led_line_t* led_line_cpy(led_line_t* pline, led_line_t* pline_src) {
-    pline->buf[0] = '\0';
+    led_line_buf(pline)[0] = '\0';
     if (led_str_isinit(&pline_src->lstr)) {
-        led_str_init_buf(&pline->lstr, pline->buf);
+        led_line_str_init(pline);
         led_str_cpy(&pline->lstr, &pline_src->lstr);
     }
     else
         led_str_reset(&pline->lstr);
     pline->selected = pline_src->selected;
+    pline->cut = pline_src->cut;
+    pline->zone_start = 0;
+    pline->zone_stop = led_str_len(&pline_src->lstr);
+    return pline;
+}
+
+inline led_line_t* led_line_view(led_line_t* pline, led_line_t* pline_src) {
+    led_str_clone(&pline->lstr, &pline_src->lstr);
+    pline->selected = pline_src->selected;
+    pline->cut = pline_src->cut;
     pline->zone_start = 0;
     pline->zone_stop = led_str_len(&pline_src->lstr);
     return pline;
@@ -650,6 +1140,44 @@ inline led_line_t* led_line_append_zn(led_line_t* pline, led_line_t* pline_src)
     return pline;
 }
 
+//-----------------------------------------------
+// LED line ring, the last lines read before the selection for a negative shift
+//-----------------------------------------------
+
+#define LED_RING_MAX 0x40
+
+// the ring lines are views on the input block, they are copied in their buffer only before the block moves.
+typedef struct {
+    led_line_t line[LED_RING_MAX];
+    // the start condition of a line, found on a line read after it
+    bool start[LED_RING_MAX];
+    size_t first;
+    size_t count;
+} led_ring_t;
+
+inline led_line_t* led_ring_push(led_ring_t* ring) {
+    size_t i = (ring->first + ring->count++) % LED_RING_MAX;
+    ring->start[i] = false;
+    return &ring->line[i];
+}
+
+inline led_line_t* led_ring_pop(led_ring_t* ring) {
+    led_line_t* pline = &ring->line[ring->first];
+    ring->first = (ring->first + 1) % LED_RING_MAX;
+    ring->count--;
+    return pline;
+}
+
+inline void led_ring_detach(led_ring_t* ring, const char* block, size_t size) {
+    led_foreach_int(ring->count) {
+        led_line_t* pline = &ring->line[(ring->first + foreach.i) % LED_RING_MAX];
+        if (pline->lstr.str >= block && pline->lstr.str < block + size) {
+            led_line_t view = *pline;
+            led_line_cpy(pline, &view);
+        }
+    }
+}
+
 inline led_line_t* led_line_append_before_zn(led_line_t* pline, led_line_t* pline_src) {
     led_str_app_zn(&pline->lstr, &pline_src->lstr, 0, pline_src->zone_start);
     return pline;
@@ -667,7 +1195,22 @@ inline led_line_t* led_line_append_after_zn(led_line_t* pline, led_line_t* pline
 typedef struct {
     size_t id;
     pcre2_code* regex;
-    char tmp_buf[LED_BUF_MAX+1];
+    led_str_match_iter_t zn_iter;
+    // char map precomputed by translate, taken from the arena
+    led_uchar_map_t* umap;
+    // separators precomputed by field and split, taken from the arena
+    led_uchar_set_t* uset;
+    // field ranges precomputed by field_project, last is SIZE_MAX when open
+    struct {
+        size_t first;
+        size_t last;
+    } frange[LED_FRANGE_MAX];
+    size_t frange_count;
+    // key schedule precomputed by aes_encrypt and aes_decrypt, taken from the arena
+    led_aes_t* aes;
+    // count of next functions processed in the same pass, or function already processed in a previous one
+    size_t fused_count;
+    bool fused;
 
     struct {
         led_str_t lstr;
@@ -678,6 +1221,12 @@ typedef struct {
 } led_fn_t;
 
 typedef void (*led_fn_impl)(led_fn_t*);
+// per char mapping of a function, fill ucout with at most LED_FN_MAP_MAX chars and return the count
+typedef size_t (*led_fn_map)(led_fn_t*, led_uchar_t, led_uchar_t* ucout);
+
+#define LED_FN_MAP_MAX 2
+#define LED_FN_TRIM_LEFT 1
+#define LED_FN_TRIM_RIGHT 2
 
 typedef struct {
     const char* short_name;
@@ -686,20 +1235,106 @@ typedef struct {
     const char* args_fmt;
     const char* help_desc;
     const char* help_format;
+    // optional per char mapping or trim, to fuse functions in a single pass
+    led_fn_map map;
+    int trim;
 } led_fn_desc_t;
 
-void led_fn_config();
+void led_fn_config(led_fn_t* pfunc);
 
 led_fn_desc_t* led_fn_table_descriptor(size_t fn_id);
 size_t led_fn_table_size();
 
+bool led_zn_next(led_fn_t* pfunc);
+
+bool led_fn_isfusable(led_fn_t* pfunc);
+bool led_fn_ispure(led_fn_t* pfunc);
+bool led_fn_iszone(led_fn_t* pfunc);
+bool led_fn_isstreamable(led_fn_t* pfunc);
+size_t led_fn_stream_cut(led_fn_t* pfunc, char* str, size_t* len);
+void led_fn_impl_fused(led_fn_t* pfunc);
+
 //-----------------------------------------------
 // LED runtime
 //-----------------------------------------------
 
+typedef struct {
+    uint64_t hash;
+    size_t len;
+    bool used;
+    bool resolved;
+    char dir[LED_FNAME_MAX+1];
+    char real[LED_FNAME_MAX+1];
+} led_path_t;
+
+// context arena: reserved memory given by chunks that live as long as the context,
+// the pages are touched on use only.
+#define LED_ARENA_MAX 0x1000000
+
+typedef struct {
+    char* mem;
+    size_t len;
+} led_arena_t;
+
+void* led_arena_alloc(led_arena_t* arena, size_t size);
+void led_arena_free(led_arena_t* arena);
+
 void led_free();
 
 typedef struct {
+    // selector, with the report and the lines: the hot state of the line loop, first and cache line aligned
+    struct {
+        int type_start;
+        pcre2_code* regex_start;
+        led_str_match_iter_t iter_start;
+        size_t val_start;
+
+        int type_stop;
+        pcre2_code* regex_stop;
+        size_t val_stop;
+
+        size_t total_count;
+        size_t count;
+        size_t shift;
+        size_t lookback;
+        bool start_ahead;
+        // lines missing before the match at the start of the input, counted as already selected
+        size_t start_missing;
+        bool selected;
+        bool inboundary;
+    } sel __attribute__((aligned(64)));
+
+    // report
+    struct {
+        size_t line_read_count;
+        size_t line_match_count;
+        size_t line_write_count;
+        size_t line_invalid_count;
+        size_t line_malformed_count;
+        size_t line_dedup_count;
+        size_t line_truncated_count;
+        size_t path_cache_hit_count;
+        size_t path_cache_miss_count;
+        size_t file_in_count;
+        size_t file_out_count;
+        size_t file_match_count;
+    } report;
+
+    led_line_t line_read;
+    led_line_t* line_prep;
+    led_line_t* line_write;
+    // function chain buffers, line_prep and line_write are swapped between functions
+    led_line_t line_buf[2];
+    // lines read ahead of the selection for a negative shift
+    led_ring_t ring;
+
+    // zone iteration state in all matches mode
+    struct {
+        bool iter;
+        bool found;
+        size_t count;
+    } zn;
+
     // options
     struct {
         bool help;
@@ -711,6 +1346,7 @@ typedef struct {
         bool pack_selected;
         bool output_selected;
         bool output_match;
+        bool output_match_all;
         bool filter_blank;
         int file_in;
         int file_out;
@@ -720,36 +1356,25 @@ typedef struct {
         led_str_t file_out_ext;
         led_str_t file_out_dir;
         led_str_t file_out_path;
+        bool seeded;
+        uint64_t seed;
+        bool memo;
     } opt;
 
-    // selector
-    struct {
-        int type_start;
-        pcre2_code* regex_start;
-        size_t val_start;
-
-        int type_stop;
-        pcre2_code* regex_stop;
-        size_t val_stop;
-
-        size_t total_count;
-        size_t count;
-        size_t shift;
-        bool selected;
-        bool inboundary;
-    } sel;
-
     led_fn_t func_list[LED_FUNC_MAX];
     size_t func_count;
 
-    struct {
-        size_t line_read_count;
-        size_t line_match_count;
-        size_t line_write_count;
-        size_t file_in_count;
-        size_t file_out_count;
-        size_t file_match_count;
-    } report;
+    led_rand_t rand;
+
+    led_dedup_t dedup;
+    led_sort_t sort;
+    led_memo_t memo;
+
+    // pack mode blocks above the line size, streamed by chunks when all the functions allow it.
+    // Each function has its input chunk and its output, taken from the arena.
+    led_rope_t rope;
+    bool rope_stream;
+    led_rope_stream_t stream[LED_FUNC_MAX];
 
     // files
     char**  file_names;
@@ -762,6 +1387,11 @@ typedef struct {
         led_str_t name;
         char buf_name[LED_FNAME_MAX+1];
         FILE* file;
+        // input block, the read lines are views on it
+        char buf_block[LED_BLOCK_MAX+1];
+        size_t block_start;
+        size_t block_stop;
+        char block_cut;
     } file_in;
     struct {
         led_str_t name;
@@ -769,12 +1399,24 @@ typedef struct {
         FILE* file;
     } file_out;
 
-    led_line_t line_read;
-    led_line_t line_prep;
-    led_line_t line_write;
-
     led_line_t line_reg[LED_REG_MAX];
 
+    // logfmt spans of the line prep, keyed on the line buffer read, dropped when this buffer is rewritten
+    struct {
+        const char* str;
+        size_t len;
+        size_t zone_start;
+        size_t zone_stop;
+        size_t count;
+        led_kv_span_t span[LED_KV_MAX];
+    } kv;
+
+    // resolved directories of realpath, direct mapped on the directory hash, taken from the arena on use
+    led_path_t* path;
+
+    // line buffers, registers and caches sized to what the functions use
+    led_arena_t arena;
+
     PCRE2_UCHAR8 buf_message[LED_MSG_MAX+1];
 
 } led_t;
@@ -0,0 +1,336 @@
+/***************************************************************************
+ Copyright (C) 2024 - Olivier ROUITS <olivier.rouits@free.fr>
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ USA
+ ***************************************************************************/
+
+#include "led.h"
+#include <sys/random.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LED_AES_X86
+#endif
+
+//-----------------------------------------------
+// LED AES software block cipher: the S-box is computed on 8 bytes at once
+// without any table lookup so the timing does not depend on the data
+//-----------------------------------------------
+
+#define LED_AES_LSB 0x0101010101010101ULL
+
+uint64_t led_aes_xtime(uint64_t x) {
+    return ((x & 0x7F7F7F7F7F7F7F7FULL) << 1) ^ (((x >> 7) & LED_AES_LSB) * 0x1B);
+}
+
+uint64_t led_aes_gmul(uint64_t a, uint64_t b) {
+    uint64_t r = 0;
+    for (int k = 0; k < 8; k++) {
+        r ^= a & (((b >> k) & LED_AES_LSB) * 0xFF);
+        a = led_aes_xtime(a);
+    }
+    return r;
+}
+
+uint64_t led_aes_rotl(uint64_t x, int n) {
+    return ((x << n) & (LED_AES_LSB * ((0xFF << n) & 0xFF))) | ((x >> (8 - n)) & (LED_AES_LSB * (0xFF >> (8 - n))));
+}
+
+uint64_t led_aes_sub(uint64_t x) {
+    // inverse as x^254 in GF(2^8), 0 stays 0
+    uint64_t x2 = led_aes_gmul(x, x);
+    uint64_t x3 = led_aes_gmul(x2, x);
+    uint64_t x6 = led_aes_gmul(x3, x3);
+    uint64_t x12 = led_aes_gmul(x6, x6);
+    uint64_t x14 = led_aes_gmul(x12, x2);
+    uint64_t x15 = led_aes_gmul(x12, x3);
+    uint64_t y = led_aes_gmul(x15, x15);
+    y = led_aes_gmul(y, y);
+    y = led_aes_gmul(y, y);
+    y = led_aes_gmul(y, y);
+    y = led_aes_gmul(y, x14);
+    // affine transform
+    return y ^ led_aes_rotl(y, 1) ^ led_aes_rotl(y, 2) ^ led_aes_rotl(y, 3) ^ led_aes_rotl(y, 4) ^ (LED_AES_LSB * 0x63);
+}
+
+uint32_t led_aes_xtime32(uint32_t x) {
+    return ((x & 0x7F7F7F7F) << 1) ^ (((x >> 7) & 0x01010101) * 0x1B);
+}
+
+void led_aes_encrypt_block(const uint8_t* rk, const uint8_t* in, uint8_t* out) {
+    uint8_t s[16], t[16];
+    uint64_t w[2];
+
+    for (int i = 0; i < 16; i++) s[i] = in[i] ^ rk[i];
+    for (int r = 1; r <= 14; r++) {
+        memcpy(w, s, 16);
+        w[0] = led_aes_sub(w[0]);
+        w[1] = led_aes_sub(w[1]);
+        memcpy(s, w, 16);
+        // shift rows, the state is stored by columns
+        for (int c = 0; c < 4; c++)
+            for (int l = 0; l < 4; l++)
+                t[4*c + l] = s[4*((c + l) & 3) + l];
+        // mix columns except in the last round
+        for (int c = 0; c < 4; c++) {
+            uint32_t x = t[4*c] | t[4*c+1] << 8 | t[4*c+2] << 16 | (uint32_t)t[4*c+3] << 24;
+            if (r < 14) {
+                uint32_t x1 = x >> 8 | x << 24;
+                uint32_t x2 = x >> 16 | x << 16;
+                uint32_t x3 = x >> 24 | x << 8;
+                x = led_aes_xtime32(x ^ x1) ^ x1 ^ x2 ^ x3;
+            }
+            for (int l = 0; l < 4; l++)
+                s[4*c + l] = (x >> (8 * l)) ^ rk[16*r + 4*c + l];
+        }
+    }
+    memcpy(out, s, 16);
+}
+
+//-----------------------------------------------
+// LED GHASH software multiply, masks instead of branches on the data
+//-----------------------------------------------
+
+uint64_t led_aes_load_be64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v = v << 8 | p[i];
+    return v;
+}
+
+void led_aes_store_be64(uint8_t* p, uint64_t v) {
+    for (int i = 7; i >= 0; i--, v >>= 8) p[i] = v;
+}
+
+void led_aes_ghash_mul(uint8_t* x, const uint8_t* h) {
+    uint64_t xh = led_aes_load_be64(x), xl = led_aes_load_be64(x + 8);
+    uint64_t vh = led_aes_load_be64(h), vl = led_aes_load_be64(h + 8);
+    uint64_t zh = 0, zl = 0;
+
+    for (int i = 0; i < 128; i++) {
+        uint64_t m = -((i < 64 ? xh >> (63 - i) : xl >> (127 - i)) & 1);
+        zh ^= vh & m;
+        zl ^= vl & m;
+        uint64_t r = -(vl & 1) & 0xE100000000000000ULL;
+        vl = vl >> 1 | vh << 63;
+        vh = (vh >> 1) ^ r;
+    }
+    led_aes_store_be64(x, zh);
+    led_aes_store_be64(x + 8, zl);
+}
+
+void led_aes_ghash_block(uint8_t* x, const uint8_t* h, const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) x[i] ^= data[i];
+    led_aes_ghash_mul(x, h);
+}
+
+//-----------------------------------------------
+// LED AES-NI and PCLMUL path
+//-----------------------------------------------
+
+#ifdef LED_AES_X86
+__attribute__((target("pclmul,sse2")))
+__m128i led_aes_ghash_clmul(__m128i a, __m128i b) {
+    // operands are byte reversed, product reduced modulo the GCM polynomial
+    __m128i t2, t3, t4, t5, t6, t7, t8, t9;
+    t3 = _mm_clmulepi64_si128(a, b, 0x00);
+    t4 = _mm_clmulepi64_si128(a, b, 0x10);
+    t5 = _mm_clmulepi64_si128(a, b, 0x01);
+    t6 = _mm_clmulepi64_si128(a, b, 0x11);
+    t4 = _mm_xor_si128(t4, t5);
+    t5 = _mm_slli_si128(t4, 8);
+    t4 = _mm_srli_si128(t4, 8);
+    t3 = _mm_xor_si128(t3, t5);
+    t6 = _mm_xor_si128(t6, t4);
+    // shift the 256 bits product left by one for the reflected convention
+    t7 = _mm_srli_epi32(t3, 31);
+    t8 = _mm_srli_epi32(t6, 31);
+    t3 = _mm_slli_epi32(t3, 1);
+    t6 = _mm_slli_epi32(t6, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    t3 = _mm_or_si128(t3, t7);
+    t6 = _mm_or_si128(t6, t8);
+    t6 = _mm_or_si128(t6, t9);
+    // reduction
+    t7 = _mm_slli_epi32(t3, 31);
+    t8 = _mm_slli_epi32(t3, 30);
+    t9 = _mm_slli_epi32(t3, 25);
+    t7 = _mm_xor_si128(t7, t8);
+    t7 = _mm_xor_si128(t7, t9);
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    t3 = _mm_xor_si128(t3, t7);
+    t2 = _mm_srli_epi32(t3, 1);
+    t4 = _mm_srli_epi32(t3, 2);
+    t5 = _mm_srli_epi32(t3, 7);
+    t2 = _mm_xor_si128(t2, t4);
+    t2 = _mm_xor_si128(t2, t5);
+    t2 = _mm_xor_si128(t2, t8);
+    t3 = _mm_xor_si128(t3, t2);
+    return _mm_xor_si128(t6, t3);
+}
+
+__attribute__((target("aes,pclmul,ssse3")))
+void led_aes_gcm_crypt_ni(led_aes_gcm_t* gcm, uint8_t* data, size_t len, bool encrypt) {
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i rk[15];
+    for (int r = 0; r < 15; r++)
+        rk[r] = _mm_loadu_si128((const __m128i*)(gcm->aes->rk + 16*r));
+    __m128i h = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)gcm->aes->h), bswap);
+    __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)gcm->x), bswap);
+    // counter blocks built byte reversed where the 32 bits counter is the low lane
+    __m128i base = _mm_and_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)gcm->j0), bswap), _mm_set_epi32(-1, -1, -1, 0));
+    size_t i = 0;
+
+    // 4 blocks interleaved to hide the aesenc latency
+    for (; i + 64 <= len; i += 64) {
+        __m128i b[4];
+        for (int k = 0; k < 4; k++)
+            b[k] = _mm_xor_si128(_mm_shuffle_epi8(_mm_or_si128(base, _mm_cvtsi32_si128(gcm->ctr++)), bswap), rk[0]);
+        for (int r = 1; r < 14; r++)
+            for (int k = 0; k < 4; k++)
+                b[k] = _mm_aesenc_si128(b[k], rk[r]);
+        for (int k = 0; k < 4; k++) {
+            __m128i d = _mm_loadu_si128((const __m128i*)(data + i + 16*k));
+            __m128i c = _mm_xor_si128(d, _mm_aesenclast_si128(b[k], rk[14]));
+            _mm_storeu_si128((__m128i*)(data + i + 16*k), c);
+            x = led_aes_ghash_clmul(_mm_xor_si128(x, _mm_shuffle_epi8(encrypt ? c : d, bswap)), h);
+        }
+    }
+    for (; i < len; i += 16) {
+        __m128i b = _mm_xor_si128(_mm_shuffle_epi8(_mm_or_si128(base, _mm_cvtsi32_si128(gcm->ctr++)), bswap), rk[0]);
+        for (int r = 1; r < 14; r++)
+            b = _mm_aesenc_si128(b, rk[r]);
+        b = _mm_aesenclast_si128(b, rk[14]);
+        // last partial block zero padded for GHASH
+        uint8_t d[16] = {0}, c[16] = {0};
+        size_t n = len - i < 16 ? len - i : 16;
+        memcpy(d, data + i, n);
+        _mm_storeu_si128((__m128i*)c, _mm_xor_si128(_mm_loadu_si128((const __m128i*)d), b));
+        memset(c + n, 0, 16 - n);
+        memcpy(data + i, c, n);
+        x = led_aes_ghash_clmul(_mm_xor_si128(x, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(encrypt ? c : d)), bswap)), h);
+    }
+    _mm_storeu_si128((__m128i*)gcm->x, _mm_shuffle_epi8(x, bswap));
+}
+
+__attribute__((target("aes,pclmul,ssse3")))
+void led_aes_gcm_finish_ni(led_aes_gcm_t* gcm, uint8_t* tag) {
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i h = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)gcm->aes->h), bswap);
+    __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)gcm->x), bswap);
+    // byte reversed length block is the bit length in the low lane
+    x = led_aes_ghash_clmul(_mm_xor_si128(x, _mm_set_epi64x(0, (long long)gcm->len * 8)), h);
+    __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i*)gcm->j0), _mm_loadu_si128((const __m128i*)gcm->aes->rk));
+    for (int r = 1; r < 14; r++)
+        b = _mm_aesenc_si128(b, _mm_loadu_si128((const __m128i*)(gcm->aes->rk + 16*r)));
+    b = _mm_aesenclast_si128(b, _mm_loadu_si128((const __m128i*)(gcm->aes->rk + 16*14)));
+    _mm_storeu_si128((__m128i*)tag, _mm_xor_si128(b, _mm_shuffle_epi8(x, bswap)));
+}
+#endif
+
+//-----------------------------------------------
+// LED AES-256-GCM
+//-----------------------------------------------
+
+void led_aes_init(led_aes_t* aes, const uint8_t* key) {
+    // AES-256 key expansion in 60 words
+    uint8_t* rk = aes->rk;
+    uint8_t rcon = 1;
+    memcpy(rk, key, LED_AES_KEY_LEN);
+    for (int i = 8; i < 60; i++) {
+        uint8_t t[4];
+        memcpy(t, rk + 4*(i - 1), 4);
+        if (i % 8 == 0 || i % 8 == 4) {
+            if (i % 8 == 0) {
+                uint8_t t0 = t[0];
+                t[0] = t[1]; t[1] = t[2]; t[2] = t[3]; t[3] = t0;
+            }
+            uint64_t w = t[0] | t[1] << 8 | t[2] << 16 | (uint64_t)t[3] << 24;
+            w = led_aes_sub(w);
+            for (int k = 0; k < 4; k++) t[k] = w >> (8 * k);
+            if (i % 8 == 0) {
+                t[0] ^= rcon;
+                rcon = led_aes_xtime(rcon);
+            }
+        }
+        for (int k = 0; k < 4; k++)
+            rk[4*i + k] = rk[4*(i - 8) + k] ^ t[k];
+    }
+    uint8_t zero[16] = {0};
+    led_aes_encrypt_block(aes->rk, zero, aes->h);
+
+    // nonces are a random start incremented at each encryption
+    led_assert(getrandom(aes->nonce, LED_AES_IV_LEN, 0) == LED_AES_IV_LEN, LED_ERR_INTERNAL, "Random nonce not available");
+    aes->hw = false;
+#ifdef LED_AES_X86
+    __builtin_cpu_init();
+    aes->hw = __builtin_cpu_supports("aes") && __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+#endif
+    led_debug("led_aes_init: hw=%d", aes->hw);
+}
+
+void led_aes_nonce(led_aes_t* aes, uint8_t* iv) {
+    memcpy(iv, aes->nonce, LED_AES_IV_LEN);
+    for (int i = LED_AES_IV_LEN - 1; i >= 0 && ++aes->nonce[i] == 0; i--);
+}
+
+void led_aes_gcm_start(led_aes_gcm_t* gcm, const led_aes_t* aes, const uint8_t* iv) {
+    gcm->aes = aes;
+    memcpy(gcm->j0, iv, LED_AES_IV_LEN);
+    gcm->j0[12] = gcm->j0[13] = gcm->j0[14] = 0;
+    gcm->j0[15] = 1;
+    memset(gcm->x, 0, 16);
+    gcm->ctr = 2;
+    gcm->len = 0;
+}
+
+void led_aes_gcm_crypt(led_aes_gcm_t* gcm, uint8_t* data, size_t len, bool encrypt) {
+    gcm->len += len;
+#ifdef LED_AES_X86
+    if (gcm->aes->hw) {
+        led_aes_gcm_crypt_ni(gcm, data, len, encrypt);
+        return;
+    }
+#endif
+    uint8_t cb[16], ks[16];
+    memcpy(cb, gcm->j0, 12);
+    for (size_t i = 0; i < len; i += 16) {
+        size_t n = len - i < 16 ? len - i : 16;
+        cb[12] = gcm->ctr >> 24; cb[13] = gcm->ctr >> 16; cb[14] = gcm->ctr >> 8; cb[15] = gcm->ctr;
+        gcm->ctr++;
+        led_aes_encrypt_block(gcm->aes->rk, cb, ks);
+        if (!encrypt) led_aes_ghash_block(gcm->x, gcm->aes->h, data + i, n);
+        for (size_t k = 0; k < n; k++) data[i + k] ^= ks[k];
+        if (encrypt) led_aes_ghash_block(gcm->x, gcm->aes->h, data + i, n);
+    }
+}
+
+void led_aes_gcm_finish(led_aes_gcm_t* gcm, uint8_t* tag) {
+#ifdef LED_AES_X86
+    if (gcm->aes->hw) {
+        led_aes_gcm_finish_ni(gcm, tag);
+        return;
+    }
+#endif
+    // no additional data, only the cipher text bit length
+    uint8_t lens[16] = {0};
+    led_aes_store_be64(lens + 8, (uint64_t)gcm->len * 8);
+    led_aes_ghash_block(gcm->x, gcm->aes->h, lens, 16);
+    led_aes_encrypt_block(gcm->aes->rk, gcm->j0, tag);
+    for (int i = 0; i < LED_AES_TAG_LEN; i++) tag[i] ^= gcm->x[i];
+}
@@ -18,6 +18,7 @@
  ***************************************************************************/
 
 #include "led.h"
+#include <sys/mman.h>
 
 //-----------------------------------------------
 // LED object
@@ -25,6 +26,33 @@
 
 led_t led;
 
+//-----------------------------------------------
+// LED arena
+//-----------------------------------------------
+
+void* led_arena_alloc(led_arena_t* arena, size_t size) {
+    if (!arena->mem) {
+        arena->mem = mmap(NULL, LED_ARENA_MAX, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        led_assert(arena->mem != MAP_FAILED, LED_ERR_INTERNAL, "Arena memory not available");
+    }
+    // chunks are cache line aligned
+    size = (size + 63) & ~(size_t)63;
+    led_assert(arena->len + size <= LED_ARENA_MAX, LED_ERR_INTERNAL, "Arena memory exceeded");
+    void* p = arena->mem + arena->len;
+    arena->len += size;
+    return p;
+}
+
+void led_arena_free(led_arena_t* arena) {
+    if (arena->mem) munmap(arena->mem, LED_ARENA_MAX);
+    arena->mem = NULL;
+    arena->len = 0;
+}
+
+char* led_line_buf_alloc() {
+    return led_arena_alloc(&led.arena, LED_BUF_MAX+1);
+}
+
 //-----------------------------------------------
 // LED tech trace and error functions
 //-----------------------------------------------
@@ -40,6 +68,7 @@ void led_free() {
         led.file_out.file = NULL;
         led_str_empty(&led.file_out.name);
     }
+    led_str_match_iter_free(&led.sel.iter_start);
     if (led.sel.regex_start != NULL) {
         pcre2_code_free(led.sel.regex_start);
         led.sel.regex_start = NULL;
@@ -49,6 +78,7 @@ void led_free() {
         led.sel.regex_stop = NULL;
     }
     led_foreach_pval(led.func_list) {
+        led_str_match_iter_free(&foreach.pval->zn_iter);
         // do not free STD regex here.
         if (foreach.pval->regex == LED_REGEX_ALL_LINE || foreach.pval->regex == LED_REGEX_ALL_MULTILINE) continue;
         if (foreach.pval->regex != NULL) {
@@ -57,6 +87,11 @@ void led_free() {
         }
     }
     led_regex_free();
+    led_rope_free(&led.rope);
+    led_sort_free(&led.sort);
+    led_dedup_free(&led.dedup);
+    led_memo_free(&led.memo);
+    led_arena_free(&led.arena);
 }
 
 void led_assert(bool cond, int code, const char* message, ...) {
@@ -19,28 +19,60 @@
 
 #include "led.h"
 
-#include <b64/cencode.h>
-#include <b64/cdecode.h>
-
 //-----------------------------------------------
 // LED functions utilities
 //-----------------------------------------------
 
 #define countof(a) (sizeof(a)/sizeof(a[0]))
 
+bool led_zn_iter_next(led_fn_t* pfunc) {
+    // like grep -o, empty matches are not output zones
+    while (led_str_match_iter_next(&pfunc->zn_iter, &led.line_prep->lstr))
+        if (pfunc->zn_iter.zone_stop > pfunc->zn_iter.zone_start) return true;
+    return false;
+}
+
 bool led_zn_pre_process(led_fn_t* pfunc) {
     bool rc;
-    led_line_init(&led.line_write);
+
+    if (pfunc->regex && led.opt.output_match_all) {
+        // all matches mode: the first zone is searched here, the next ones by led_zn_next()
+        if (!led.zn.iter) {
+            led_line_init(led.line_write);
+            led_str_match_iter_reset(&pfunc->zn_iter);
+            led.zn.iter = true;
+            led.zn.count = 0;
+            led.zn.found = led_zn_iter_next(pfunc);
+        }
+        rc = led.zn.found;
+        if (rc) {
+            led.line_prep->zone_start = pfunc->zn_iter.zone_start;
+            led.line_prep->zone_stop = pfunc->zn_iter.zone_stop;
+            if (led.zn.count++ > 0)
+                led_str_app_uchar(&led.line_write->lstr, '\n');
+        }
+        else
+            led.line_prep->zone_start = led.line_prep->zone_stop = led_str_len(&led.line_prep->lstr);
+        return rc;
+    }
+
+    led_line_init(led.line_write);
 
     if (pfunc->regex) {
-        led.line_prep.zone_start = led.line_prep.zone_stop = led_str_len(&led.line_prep.lstr);
-        rc = led_str_match_offset(&led.line_prep.lstr, pfunc->regex, &led.line_prep.zone_start, &led.line_prep.zone_stop);
+        led_str_match_iter_reset(&pfunc->zn_iter);
+        rc = led_str_match_iter_next(&pfunc->zn_iter, &led.line_prep->lstr);
+        if (rc) {
+            led.line_prep->zone_start = pfunc->zn_iter.zone_start;
+            led.line_prep->zone_stop = pfunc->zn_iter.zone_stop;
+        }
+        else
+            led.line_prep->zone_start = led.line_prep->zone_stop = led_str_len(&led.line_prep->lstr);
         if (!led.opt.output_match)
-            led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, 0, led.line_prep.zone_start);
+            led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, 0, led.line_prep->zone_start);
     }
     else {
-        led.line_prep.zone_start = 0;
-        led.line_prep.zone_stop = led_str_len(&led.line_prep.lstr);
+        led.line_prep->zone_start = 0;
+        led.line_prep->zone_stop = led_str_len(&led.line_prep->lstr);
         rc = true;
     }
 
@@ -49,7 +81,20 @@ bool led_zn_pre_process(led_fn_t* pfunc) {
 
 void led_zn_post_process() {
     if (!led.opt.output_match)
-        led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_stop, led.line_prep.lstr.len);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_stop, led.line_prep->lstr.len);
+}
+
+bool led_zn_next(led_fn_t* pfunc) {
+    // only zone functions called in all matches mode have a next zone
+    if (!led.zn.iter) return false;
+
+    led.zn.found = led.zn.found && led_zn_iter_next(pfunc);
+    if (!led.zn.found) {
+        led.zn.iter = false;
+        // like grep -o, a line without any matching zone is not output
+        if (led.zn.count == 0) led_line_reset(led.line_write);
+    }
+    return led.zn.found;
 }
 
 //-----------------------------------------------
@@ -58,11 +103,11 @@ void led_zn_post_process() {
 
 void led_fn_impl_register(led_fn_t* pfunc) {
     // register is a passtrough function, line stays unchanged
-    led_line_cpy(&led.line_write, &led.line_prep);
+    led_line_cpy(led.line_write, led.line_prep);
 
     if (pfunc->regex) {
         pcre2_match_data* match_data = pcre2_match_data_create_from_pattern(pfunc->regex, NULL);
-        int rc = pcre2_match(pfunc->regex, (PCRE2_SPTR)led_str_str(&led.line_prep.lstr), led_str_len(&led.line_prep.lstr), 0, 0, match_data, NULL);
+        int rc = pcre2_match(pfunc->regex, (PCRE2_SPTR)led_str_str(&led.line_prep->lstr), led_str_len(&led.line_prep->lstr), 0, 0, match_data, NULL);
         PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(match_data);
         led_debug("led_fn_impl_register: match_count %d ", rc);
 
@@ -74,18 +119,18 @@ void led_fn_impl_register(led_fn_t* pfunc) {
                 int iv = (rc - 1) * 2;
                 led_debug("led_fn_impl_register: match_offset values %d %d", ovector[iv], ovector[iv+1]);
                 led_line_init(&led.line_reg[ir]);
-                led_str_app_zn(&led.line_reg[ir].lstr, &led.line_prep.lstr, ovector[iv], ovector[iv+1]);
+                led_str_app_zn(&led.line_reg[ir].lstr, &led.line_prep->lstr, ovector[iv], ovector[iv+1]);
                 led_debug("led_fn_impl_register: register value %d (%s)", ir, led_str_str(&led.line_reg[ir].lstr));
             }
         }
-        else {
+        else if (rc > 0) {
             // usecase with unfixed register ID, catch all groups and distribute into registers, R0 is the global matching zone
             led_foreach_int(rc)
                 if (foreach.i < LED_REG_MAX) {
                     int iv = foreach.i * 2;
                     led_debug("led_fn_impl_register: match_offset values %d %d", ovector[iv], ovector[iv+1]);
                     led_line_init(&led.line_reg[foreach.i]);
-                    led_str_app_zn(&led.line_reg[foreach.i].lstr, &led.line_prep.lstr, ovector[iv], ovector[iv+1]);
+                    led_str_app_zn(&led.line_reg[foreach.i].lstr, &led.line_prep->lstr, ovector[iv], ovector[iv+1]);
                     led_debug("led_fn_impl_register: register value %d (%s)", foreach.i, led_str_str(&led.line_reg[foreach.i].lstr));
                 }
         }
@@ -95,7 +140,7 @@ void led_fn_impl_register(led_fn_t* pfunc) {
         led_debug("led_fn_impl_register: no regx, match all");
         size_t ir = pfunc->arg_count > 0 ? pfunc->arg[0].uval : 0;
         led_assert(ir < LED_REG_MAX, LED_ERR_ARG, "Register ID %lu exeed maximum register ID %d", ir, LED_REG_MAX-1);
-        led_line_cpy(&led.line_reg[ir], &led.line_prep);
+        led_line_cpy(&led.line_reg[ir], led.line_prep);
     }
 }
 
@@ -112,12 +157,12 @@ void led_fn_impl_register_recall(led_fn_t* pfunc) {
             led.line_reg[ir].zone_start = 0;
             led.line_reg[ir].zone_stop = led_str_len(&led.line_reg[ir].lstr);
         }
-        led_line_init(&led.line_write);
-        led_str_app_zn(&led.line_write.lstr, &led.line_reg[ir].lstr, led.line_reg[ir].zone_start, led.line_reg[ir].zone_stop);
+        led_line_init(led.line_write);
+        led_str_app_zn(&led.line_write->lstr, &led.line_reg[ir].lstr, led.line_reg[ir].zone_start, led.line_reg[ir].zone_stop);
     }
     else {
         // no change to current line if register is not init
-        led_line_cpy(&led.line_write, &led.line_prep);
+        led_line_cpy(led.line_write, led.line_prep);
     }
 }
 
@@ -188,154 +233,183 @@ void led_fn_helper_substitute(led_fn_t* pfunc, led_str_t* sinput, led_str_t* sou
 }
 
 void led_fn_impl_substitute(led_fn_t* pfunc) {
-    led_fn_helper_substitute(pfunc, &led.line_prep.lstr, led_str_init_buf(&led.line_write.lstr,led.line_write.buf));
+    led_fn_helper_substitute(pfunc, &led.line_prep->lstr, led_line_str_init(led.line_write));
 }
 
 void led_fn_impl_delete(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    if (led.line_prep.zone_start == 0 && led.line_prep.zone_stop == led_str_len(&led.line_prep.lstr))
+    if (led.line_prep->zone_start == 0 && led.line_prep->zone_stop == led_str_len(&led.line_prep->lstr))
         // delete all the line if it all match
-        led_line_reset(&led.line_write);
+        led_line_reset(led.line_write);
     else
         // only remove matching zone
         led_zn_post_process();
 }
 
+void led_fn_impl_dedup(led_fn_t* pfunc) {
+    // the zone is the key, lines without zone are kept
+    if (led_zn_pre_process(pfunc)
+        && !led_dedup_add(&led.dedup, led_str_str_at(&led.line_prep->lstr, led.line_prep->zone_start),
+            led.line_prep->zone_stop - led.line_prep->zone_start, pfunc - led.func_list)) {
+        led.report.line_dedup_count++;
+        led_line_reset(led.line_write);
+    }
+    else
+        led_line_cpy(led.line_write, led.line_prep);
+}
+
+void led_fn_impl_dedup_exact(led_fn_t* pfunc) { led_fn_impl_dedup(pfunc); }
+
+void led_fn_impl_sort(led_fn_t* pfunc) {
+    // the line goes to the sort stage with the zone as key, it is output at the end of the file
+    led_zn_pre_process(pfunc);
+    led_sort_add(&led.sort, led_str_str(&led.line_prep->lstr), led_str_len(&led.line_prep->lstr), led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_line_reset(led.line_write);
+}
+
 void led_fn_impl_delete_blank(led_fn_t* pfunc) {
     (void) pfunc;
-    if (led_str_isempty(&led.line_prep.lstr) || led_str_isblank(&led.line_prep.lstr))
-        led_line_reset(&led.line_write);
+    if (led_str_isempty(&led.line_prep->lstr) || led_str_isblank(&led.line_prep->lstr))
+        led_line_reset(led.line_write);
     else
-        led_str_cpy(&led.line_write.lstr, &led.line_prep.lstr);
+        led_line_cpy(led.line_write, led.line_prep);
 }
 
 void led_fn_impl_insert(led_fn_t* pfunc) {
     led_str_decl(newline, LED_BUF_MAX);
-    led_fn_helper_substitute(pfunc, &led.line_prep.lstr, &newline);
+    led_fn_helper_substitute(pfunc, &led.line_prep->lstr, &newline);
 
-    led_str_init_buf(&led.line_write.lstr, led.line_write.buf);
-    led_str_empty(&led.line_write.lstr);
+    led_line_str_init(led.line_write);
+    led_str_empty(&led.line_write->lstr);
     size_t lcount = pfunc->arg_count > 1 ? pfunc->arg[1].uval : 1;
     led_foreach_int(lcount) {
-        led_str_app(&led.line_write.lstr, &newline);
-        led_str_app_uchar(&led.line_write.lstr, '\n');
+        led_str_app(&led.line_write->lstr, &newline);
+        led_str_app_uchar(&led.line_write->lstr, '\n');
     }
-    led_str_app(&led.line_write.lstr, &led.line_prep.lstr);
+    led_str_app(&led.line_write->lstr, &led.line_prep->lstr);
 }
 
 void led_fn_impl_append(led_fn_t* pfunc) {
     led_str_decl(newline, LED_BUF_MAX);
-    led_fn_helper_substitute(pfunc, &led.line_prep.lstr, &newline);
+    led_fn_helper_substitute(pfunc, &led.line_prep->lstr, &newline);
 
-    led_str_init_buf(&led.line_write.lstr,led.line_write.buf);
-    led_str_cpy(&led.line_write.lstr, &led.line_prep.lstr);
+    led_line_str_init(led.line_write);
+    led_str_cpy(&led.line_write->lstr, &led.line_prep->lstr);
     size_t lcount = pfunc->arg_count > 1 ? pfunc->arg[1].uval : 1;
     led_foreach_int(lcount) {
-        led_str_app_uchar(&led.line_write.lstr, '\n');
-        led_str_app(&led.line_write.lstr, &newline);;
+        led_str_app_uchar(&led.line_write->lstr, '\n');
+        led_str_app(&led.line_write->lstr, &newline);;
     }
 }
 
-void led_fn_impl_range_sel(led_fn_t* pfunc) {
-    led_line_init(&led.line_write);
+size_t led_fn_helper_pos_uchar_n(size_t idx, size_t n, bool isutf8) {
+    led_str_t* lstr = &led.line_prep->lstr;
+    // valid UTF-8 chars are counted by blocks
+    if (isutf8)
+        return idx + led_str_pos_uchar_n(lstr->str + idx, lstr->len - idx, n);
+    led_foreach_int(n)
+        if (idx < led_str_len(lstr))
+            led_str_uchar_next(lstr, idx, &idx);
+    return idx;
+}
+
+void led_fn_helper_range_zone(led_fn_t* pfunc) {
+    led_str_t* lstr = &led.line_prep->lstr;
+    bool isutf8 = led_str_isutf8(lstr->str, lstr->len);
 
     if (led_str_iscontent(&pfunc->arg[0].lstr)) {
-        long val = pfunc->arg[0].val;
         size_t uval = pfunc->arg[0].uval;
-        if (val >= 0) {
-            led.line_prep.zone_start = 0;
-            led_foreach_int(uval)
-                if (led.line_prep.zone_start < led_str_len(&led.line_prep.lstr))
-                    led_str_uchar_next(&led.line_prep.lstr, led.line_prep.zone_start, &led.line_prep.zone_start);
+        if (pfunc->arg[0].val >= 0)
+            led.line_prep->zone_start = led_fn_helper_pos_uchar_n(0, uval, isutf8);
+        else if (isutf8) {
+            size_t count = led_str_uchar_count(lstr->str, lstr->len);
+            led.line_prep->zone_start = uval < count ? led_fn_helper_pos_uchar_n(0, count - uval, isutf8) : 0;
         }
         else {
-            led.line_prep.zone_start = led_str_len(&led.line_prep.lstr);
+            led.line_prep->zone_start = led_str_len(lstr);
             led_foreach_int(uval)
-                if (led.line_prep.zone_start > 0)
-                    led_str_uchar_prev(&led.line_prep.lstr, led.line_prep.zone_start, &led.line_prep.zone_start);
+                if (led.line_prep->zone_start > 0)
+                    led_str_uchar_prev(lstr, led.line_prep->zone_start, &led.line_prep->zone_start);
         }
     }
-    if (led_str_iscontent(&pfunc->arg[1].lstr)) {
-        size_t uval = pfunc->arg[1].uval;
-        led.line_prep.zone_stop = led.line_prep.zone_start;
-        led_foreach_int(uval)
-            if (led.line_prep.zone_stop < led_str_len(&led.line_prep.lstr))
-                led_str_uchar_next(&led.line_prep.lstr, led.line_prep.zone_stop, &led.line_prep.zone_stop);
-    }
+    if (led_str_iscontent(&pfunc->arg[1].lstr))
+        led.line_prep->zone_stop = led_fn_helper_pos_uchar_n(led.line_prep->zone_start, pfunc->arg[1].uval, isutf8);
     else
-        led.line_prep.zone_stop = led_str_len(&led.line_prep.lstr);
+        led.line_prep->zone_stop = led_str_len(lstr);
+}
+
+void led_fn_impl_range_sel(led_fn_t* pfunc) {
+    led_line_init(led.line_write);
+
+    led_fn_helper_range_zone(pfunc);
 
-    led_line_append_zn(&led.line_write, &led.line_prep);
+    led_line_append_zn(led.line_write, led.line_prep);
 }
 
 void led_fn_impl_range_unsel(led_fn_t* pfunc) {
-    led_line_init(&led.line_write);
+    led_line_init(led.line_write);
 
-    if (led_str_iscontent(&pfunc->arg[0].lstr)) {
-        long val = pfunc->arg[0].val;
-        size_t uval = pfunc->arg[0].uval;
-        if (val >= 0) {
-            led.line_prep.zone_start = 0;
-            led_foreach_int(uval)
-                if (led.line_prep.zone_start < led_str_len(&led.line_prep.lstr))
-                    led_str_uchar_next(&led.line_prep.lstr, led.line_prep.zone_start, &led.line_prep.zone_start);
-        }
-        else {
-            led.line_prep.zone_start = led_str_len(&led.line_prep.lstr);
-            led_foreach_int(uval)
-                if (led.line_prep.zone_start > 0)
-                    led_str_uchar_prev(&led.line_prep.lstr, led.line_prep.zone_start, &led.line_prep.zone_start);
-        }
-    }
-    if (led_str_iscontent(&pfunc->arg[1].lstr)) {
-        size_t uval = pfunc->arg[1].uval;
-        led.line_prep.zone_stop = led.line_prep.zone_start;
-        led_foreach_int(uval)
-            if (led.line_prep.zone_stop < led_str_len(&led.line_prep.lstr))
-                led_str_uchar_next(&led.line_prep.lstr, led.line_prep.zone_stop, &led.line_prep.zone_stop);
+    led_fn_helper_range_zone(pfunc);
+
+    led_line_append_before_zn(led.line_write, led.line_prep);
+    led_line_append_after_zn(led.line_write, led.line_prep);
+}
+
+void led_fn_config_uset(led_fn_t* pfunc, const char* seps) {
+    pfunc->uset = led_arena_alloc(&led.arena, sizeof(led_uchar_set_t));
+    led_uchar_set_init(pfunc->uset, seps);
+}
+
+void led_fn_config_translate(led_fn_t* pfunc) {
+    pfunc->umap = led_arena_alloc(&led.arena, sizeof(led_uchar_map_t));
+    led_uchar_map_init(pfunc->umap);
+    size_t ival = 0;
+    led_str_foreach_uchar(&pfunc->arg[0].lstr) {
+        // the first occurrence of a char defines its translation, a missing one keeps the char
+        led_uchar_t uct = ival < led_str_len(&pfunc->arg[1].lstr) ? led_str_uchar_next(&pfunc->arg[1].lstr, ival, &ival) : '\0';
+        if (led_str_find_uchar_zn(&pfunc->arg[0].lstr, foreach.uc, 0, foreach.i) < foreach.i) continue;
+        led_uchar_map_set(pfunc->umap, foreach.uc, uct ? uct : foreach.uc);
     }
-    else
-        led.line_prep.zone_stop = led_str_len(&led.line_prep.lstr);
+}
 
-    led_line_append_before_zn(&led.line_write, &led.line_prep);
-    led_line_append_after_zn(&led.line_write, &led.line_prep);
+size_t led_fn_map_translate(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) {
+    ucout[0] = led_uchar_map_get(pfunc->umap, uc);
+    return 1;
 }
 
 void led_fn_impl_translate(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        led_uchar_t uc = foreach.uc;
-        led_uchar_t uct = '\0';
-        led_str_foreach_uchar(&pfunc->arg[0].lstr) {
-            if (foreach.uc == uc) {
-                if ((uct = led_str_uchar_n(&pfunc->arg[1].lstr, foreach.uc_count)))
-                    led_str_app_uchar(&led.line_write.lstr, uct);
-                break;
-            }
-        }
-        if (!uct)
-            led_str_app_uchar(&led.line_write.lstr, uc);
-    }
+    led_str_app_map_zn(&led.line_write->lstr, &led.line_prep->lstr, pfunc->umap, led.line_prep->zone_start, led.line_prep->zone_stop);
 
     led_zn_post_process();
 }
 
+size_t led_fn_map_case_lower(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) {
+    (void) pfunc;
+    ucout[0] = led_uchar_tolower(uc);
+    return 1;
+}
+
 void led_fn_impl_case_lower(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
+    led_str_app_lower_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
 
     led_zn_post_process();
 }
 
+size_t led_fn_map_case_upper(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) {
+    (void) pfunc;
+    ucout[0] = led_uchar_toupper(uc);
+    return 1;
+}
+
 void led_fn_impl_case_upper(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        led_str_app_uchar(&led.line_write.lstr, led_uchar_toupper(foreach.uc));
+    led_str_app_upper_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
 
     led_zn_post_process();
 }
@@ -343,10 +417,10 @@ void led_fn_impl_case_upper(led_fn_t* pfunc) {
 void led_fn_impl_case_first(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_app_uchar(&led.line_write.lstr, led_uchar_toupper(led_str_uchar_next(&led.line_prep.lstr, led.line_prep.zone_start, &led.line_prep.zone_start)));
+    led_str_app_uchar(&led.line_write->lstr, led_uchar_toupper(led_str_uchar_next(&led.line_prep->lstr, led.line_prep->zone_start, &led.line_prep->zone_start)));
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop)
+        led_str_app_uchar(&led.line_write->lstr, led_uchar_tolower(foreach.uc));
 
     led_zn_post_process();
 }
@@ -355,11 +429,11 @@ void led_fn_impl_case_camel(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
     bool wasword = false;
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop) {
         bool isword = led_uchar_isalnum(foreach.uc) || foreach.uc == '_';
         if (isword) {
-            if (wasword) led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
-            else led_str_app_uchar(&led.line_write.lstr, led_uchar_toupper(foreach.uc));
+            if (wasword) led_str_app_uchar(&led.line_write->lstr, led_uchar_tolower(foreach.uc));
+            else led_str_app_uchar(&led.line_write->lstr, led_uchar_toupper(foreach.uc));
         }
         wasword = isword;
     }
@@ -370,12 +444,12 @@ void led_fn_impl_case_camel(led_fn_t* pfunc) {
 void led_fn_impl_case_snake(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        led_uchar_t ucnext = led_str_uchar_at(&led.line_write.lstr, foreach.i_next);
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop) {
+        led_uchar_t ucnext = led_str_uchar_at(&led.line_prep->lstr, foreach.i_next);
         if (led_uchar_isalnum(foreach.uc))
-            led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
+            led_str_app_uchar(&led.line_write->lstr, led_uchar_tolower(foreach.uc));
         else if (ucnext != '_')
-            led_str_app_uchar(&led.line_write.lstr, '_');
+            led_str_app_uchar(&led.line_write->lstr, '_');
     }
 
     led_zn_post_process();
@@ -384,14 +458,14 @@ void led_fn_impl_case_snake(led_fn_t* pfunc) {
 void led_fn_impl_quote_base(led_fn_t* pfunc, led_uchar_t q) {
     led_zn_pre_process(pfunc);
 
-    if (! (led_str_uchar_at(&led.line_prep.lstr, led.line_prep.zone_start) == q && led_str_uchar_at(&led.line_prep.lstr, led.line_prep.zone_stop - 1) == q) ) {
+    if (! (led_str_uchar_at(&led.line_prep->lstr, led.line_prep->zone_start) == q && led_str_uchar_at(&led.line_prep->lstr, led.line_prep->zone_stop - 1) == q) ) {
         led_debug("led_fn_impl_quote_base: quote active");
-        led_str_app_uchar(&led.line_write.lstr, q);
-        led_line_append_zn(&led.line_write, &led.line_prep);
-        led_str_app_uchar(&led.line_write.lstr, q);
+        led_str_app_uchar(&led.line_write->lstr, q);
+        led_line_append_zn(led.line_write, led.line_prep);
+        led_str_app_uchar(&led.line_write->lstr, q);
     }
     else
-        led_line_append_zn(&led.line_write, &led.line_prep);
+        led_line_append_zn(led.line_write, led.line_prep);
 
     led_zn_post_process();
 }
@@ -406,38 +480,40 @@ void led_fn_impl_quote_remove(led_fn_t* pfunc) {
 
     bool found = false;
     led_foreach_char(QUOTES)
-        if (led_str_uchar_at(&led.line_prep.lstr, led.line_prep.zone_start) == (led_uchar_t)foreach.c
-            && led_str_uchar_at(&led.line_prep.lstr, led.line_prep.zone_stop - 1) == (led_uchar_t)foreach.c) {
+        if (led_str_uchar_at(&led.line_prep->lstr, led.line_prep->zone_start) == (led_uchar_t)foreach.c
+            && led_str_uchar_at(&led.line_prep->lstr, led.line_prep->zone_stop - 1) == (led_uchar_t)foreach.c) {
             found = true;
             led_debug("led_fn_impl_quote_remove: quote found %c", foreach.c);
             break;
         }
     if (found)
-        led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start + 1, led.line_prep.zone_stop - 1);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start + 1, led.line_prep->zone_stop - 1);
     else
-        led_line_append_zn(&led.line_write, &led.line_prep);
+        led_line_append_zn(led.line_write, led.line_prep);
 
     led_zn_post_process();
 }
 
 //TODO use led_str trim functions
 
+size_t led_fn_helper_trim_left_pos(size_t start, size_t stop) {
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, start, stop)
+        if (!led_uchar_isspace(foreach.uc)) return foreach.i;
+    return stop;
+}
+
+size_t led_fn_helper_trim_right_pos(size_t start, size_t stop) {
+    led_str_foreach_uchar_zn_r(&led.line_prep->lstr, start, stop)
+        if (!led_uchar_isspace(foreach.uc)) return foreach.i_next;
+    return start;
+}
+
 void led_fn_impl_trim(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        if (!led_uchar_isspace(foreach.uc)) {
-            led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, foreach.i, led.line_prep.zone_stop);
-            break;
-        }
-    }
-
-    led_str_foreach_uchar_zn_r(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        if (!led_uchar_isspace(foreach.uc)) {
-            led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start, foreach.i_next);
-            break;
-        }
-    }
+    size_t start = led_fn_helper_trim_left_pos(led.line_prep->zone_start, led.line_prep->zone_stop);
+    size_t stop = led_fn_helper_trim_right_pos(start, led.line_prep->zone_stop);
+    led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, start, stop);
 
     led_zn_post_process();
 }
@@ -445,12 +521,8 @@ void led_fn_impl_trim(led_fn_t* pfunc) {
 void led_fn_impl_trim_left(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        if (!led_uchar_isspace(foreach.uc)) {
-            led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, foreach.i, led.line_prep.zone_stop);
-            break;
-        }
-    }
+    size_t start = led_fn_helper_trim_left_pos(led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, start, led.line_prep->zone_stop);
 
     led_zn_post_process();
 }
@@ -458,95 +530,201 @@ void led_fn_impl_trim_left(led_fn_t* pfunc) {
 void led_fn_impl_trim_right(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn_r(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        if (!led_uchar_isspace(foreach.uc)) {
-            led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start, foreach.i_next);
-            break;
-        }
-    }
+    size_t stop = led_fn_helper_trim_right_pos(led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, stop);
 
     led_zn_post_process();
 }
 
 void led_fn_impl_base64_encode(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
+    led_str_app_base64_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop, false);
+    led_zn_post_process();
+}
 
-    char b64buf[LED_BUF_MAX];
-    base64_encodestate base64_state;
-	size_t count = 0;
+void led_fn_impl_base64_decode(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+    led_str_app_unbase64_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_zn_post_process();
+}
 
-	base64_init_encodestate(&base64_state);
-	count = base64_encode_block(
-        led_str_str_at(&led.line_prep.lstr, led.line_prep.zone_start),
-        led.line_prep.zone_stop - led.line_prep.zone_start,
-        b64buf,
-        &base64_state);
-	count += base64_encode_blockend(
-        b64buf + count,
-        &base64_state);
-    // remove newline and final 0
-    b64buf[count - 1] = '\0';
+void led_fn_impl_base64url_encode(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+    led_str_app_base64_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop, true);
+    led_zn_post_process();
+}
 
-    led_str_app_str(&led.line_write.lstr, b64buf);
+void led_fn_impl_hex_encode(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+    led_str_app_hex_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
     led_zn_post_process();
 }
 
-void led_fn_impl_base64_decode(led_fn_t* pfunc) {
+void led_fn_impl_hex_decode(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
+    led_str_app_unhex_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_zn_post_process();
+}
+
+void led_fn_helper_app_digest(const uint8_t* digest, size_t len) {
+    led_foreach_int(len) {
+        led_str_app_uchar(&led.line_write->lstr, "0123456789abcdef"[digest[foreach.i] >> 4]);
+        led_str_app_uchar(&led.line_write->lstr, "0123456789abcdef"[digest[foreach.i] & 0x0F]);
+    }
+}
 
-    char b64buf[LED_BUF_MAX];
-	base64_decodestate base64_state;
-	size_t count = 0;
+void led_fn_impl_hash_crc32c(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
 
-	base64_init_decodestate(&base64_state);
-	count = base64_decode_block(
-        led_str_str_at(&led.line_prep.lstr, led.line_prep.zone_start),
-        led.line_prep.zone_stop - led.line_prep.zone_start,
-        b64buf,
-        &base64_state);
-    b64buf[count] = '\0';
+    uint32_t crc = led_hash_crc32c(led_str_str_at(&led.line_prep->lstr, led.line_prep->zone_start), led.line_prep->zone_stop - led.line_prep->zone_start);
+    uint8_t digest[4] = { crc >> 24, crc >> 16, crc >> 8, crc };
+    led_fn_helper_app_digest(digest, sizeof digest);
 
-    led_str_app_str(&led.line_write.lstr, b64buf);
     led_zn_post_process();
 }
 
-void led_fn_impl_url_encode(led_fn_t* pfunc) {
-    static const char NOTRESERVED[] = "-._~";
-    static const char HEX[] = "0123456789ABCDEF";
-    char pcbuf[4] = "%00";
+void led_fn_impl_hash_xxh64(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+
+    uint64_t h = led_hash_xxh64(led_str_str_at(&led.line_prep->lstr, led.line_prep->zone_start), led.line_prep->zone_stop - led.line_prep->zone_start, 0);
+    uint8_t digest[8];
+    led_foreach_int(8)
+        digest[foreach.i] = h >> (56 - 8 * foreach.i);
+    led_fn_helper_app_digest(digest, sizeof digest);
 
+    led_zn_post_process();
+}
+
+void led_fn_impl_hash_sha256(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        // we encode UTF8 chars byte per byte.
-        if (led_uchar_isalnum(foreach.uc) || led_uchar_in_str(foreach.uc, NOTRESERVED))
-            led_str_app_uchar(&led.line_write.lstr, foreach.uc);
-        else {
-            led_uchar_t uc = foreach.uc;
-            size_t uc_size = foreach.uc_size;
-            led_foreach_int(uc_size) {
-                uint8_t cbyte = uc >> (8*(uc_size-1 - foreach.i));
-                pcbuf[1] = HEX[(cbyte >> 4) & 0x0F];
-                pcbuf[2] = HEX[cbyte & 0x0F];
-                led_str_app_str(&led.line_write.lstr, pcbuf);
-            }
+    uint8_t digest[32];
+    led_hash_sha256(led_str_str_at(&led.line_prep->lstr, led.line_prep->zone_start), led.line_prep->zone_stop - led.line_prep->zone_start, digest);
+    led_fn_helper_app_digest(digest, sizeof digest);
+
+    led_zn_post_process();
+}
+
+void led_fn_impl_aes_encrypt(led_fn_t* pfunc) {
+    // lines without matching zone are not encrypted
+    if (!led_zn_pre_process(pfunc)) {
+        led_zn_post_process();
+        return;
+    }
+
+    const char* src = led_str_str_at(&led.line_prep->lstr, led.line_prep->zone_start);
+    size_t len = led.line_prep->zone_stop - led.line_prep->zone_start;
+
+    // the cipher text not fitting in the line is not produced, the zone is left unchanged
+    size_t b64_len = (LED_AES_IV_LEN + 2) / 3 * 4 + (len + LED_AES_TAG_LEN + 2) / 3 * 4;
+    if (led_str_len(&led.line_write->lstr) + b64_len + led_str_len(&led.line_prep->lstr) - led.line_prep->zone_stop > LED_BUF_MAX) {
+        led.report.line_malformed_count++;
+        led_line_append_zn(led.line_write, led.line_prep);
+        led_zn_post_process();
+        return;
+    }
+
+    // base64 of nonce, cipher text and tag streamed by chunks of 48 bytes giving 64 chars
+    uint8_t buf[48 + LED_AES_TAG_LEN];
+    led_str_t chunk;
+    led_str_init_view(&chunk, (char*)buf, sizeof buf);
+    led_aes_gcm_t gcm;
+    led_aes_nonce(pfunc->aes, buf);
+    led_aes_gcm_start(&gcm, pfunc->aes, buf);
+    led_str_app_base64_zn(&led.line_write->lstr, &chunk, 0, LED_AES_IV_LEN, false);
+
+    size_t i = 0;
+    for (; i + 48 < len; i += 48) {
+        memcpy(buf, src + i, 48);
+        led_aes_gcm_crypt(&gcm, buf, 48, true);
+        led_str_app_base64_zn(&led.line_write->lstr, &chunk, 0, 48, false);
+    }
+    memcpy(buf, src + i, len - i);
+    led_aes_gcm_crypt(&gcm, buf, len - i, true);
+    led_aes_gcm_finish(&gcm, buf + len - i);
+    led_str_app_base64_zn(&led.line_write->lstr, &chunk, 0, len - i + LED_AES_TAG_LEN, false);
+
+    led_zn_post_process();
+}
+
+void led_fn_impl_aes_decrypt(led_fn_t* pfunc) {
+    if (!led_zn_pre_process(pfunc)) {
+        led_zn_post_process();
+        return;
+    }
+
+    // decoded then decrypted in place in the line write, restored if not authenticated
+    led_str_t* lstr = &led.line_write->lstr;
+    size_t start = lstr->len;
+    led_str_app_unbase64_zn(lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
+    size_t len = lstr->len - start;
+    bool valid = len >= LED_AES_IV_LEN + LED_AES_TAG_LEN;
+    if (valid) {
+        uint8_t* data = (uint8_t*)lstr->str + start;
+        uint8_t tag[LED_AES_TAG_LEN];
+        uint8_t diff = 0;
+        len -= LED_AES_IV_LEN + LED_AES_TAG_LEN;
+        led_aes_gcm_t gcm;
+        led_aes_gcm_start(&gcm, pfunc->aes, data);
+        led_aes_gcm_crypt(&gcm, data + LED_AES_IV_LEN, len, false);
+        led_aes_gcm_finish(&gcm, tag);
+        led_foreach_int(LED_AES_TAG_LEN)
+            diff |= tag[foreach.i] ^ data[LED_AES_IV_LEN + len + foreach.i];
+        valid = diff == 0;
+        if (valid) {
+            memmove(data, data + LED_AES_IV_LEN, len);
+            lstr->len = start + len;
+            lstr->str[lstr->len] = '\0';
         }
+    }
+    if (!valid) {
+        led.report.line_malformed_count++;
+        lstr->len = start;
+        led_line_append_zn(led.line_write, led.line_prep);
+    }
+
     led_zn_post_process();
 }
 
-void led_fn_impl_shell_escape(led_fn_t* pfunc) {
-    static const char fname_stdchar_table[] = "/._-~:=%";
-    led_str_decl_str(table, fname_stdchar_table);
+void led_fn_impl_url_encode(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+    // UTF8 chars are encoded byte per byte
+    led_str_app_url_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_zn_post_process();
+}
 
+void led_fn_impl_url_decode(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
+    led_str_app_unurl_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
+    led_zn_post_process();
+}
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        if (led_uchar_isalnum(foreach.uc) || led_str_has_uchar(&table, foreach.uc))
-            led_str_app_uchar(&led.line_write.lstr, foreach.uc);
-        else {
-            led_str_app_uchar(&led.line_write.lstr, '\\');
-            led_str_app_uchar(&led.line_write.lstr, foreach.uc);
-        }
+size_t led_fn_map_shell_escape(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) {
+    (void) pfunc;
+    if (uc < 0x80 && led_byte_class_shell.byte[uc]) {
+        ucout[0] = uc;
+        return 1;
+    }
+    ucout[0] = '\\';
+    ucout[1] = uc;
+    return 2;
+}
+
+void led_fn_impl_shell_escape(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+
+    const char* str = led_str_str(&led.line_prep->lstr);
+    size_t i = led.line_prep->zone_start;
+    size_t stop = led.line_prep->zone_stop;
+    while (i < stop) {
+        // safe bytes copied at once, the next char escaped
+        size_t n = led_str_span_class(str + i, stop - i, &led_byte_class_shell);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, i, i + n);
+        i += n;
+        if (i >= stop) break;
+        led_str_app_uchar(&led.line_write->lstr, '\\');
+        led_str_app_uchar(&led.line_write->lstr, led_str_uchar_next(&led.line_prep->lstr, i, &i));
+    }
 
     led_zn_post_process();
 }
@@ -555,37 +733,81 @@ void led_fn_impl_shell_unescape(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
     bool prev_is_esc = false;
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop) {
         if (!prev_is_esc && foreach.uc == '\\')
             prev_is_esc = true;
         else
-            led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+            led_str_app_uchar(&led.line_write->lstr, foreach.uc);
     }
     led_zn_post_process();
 }
 
+bool led_fn_helper_realpath(const char* path, char* real) {
+    led_str_decl_str(lpath, path);
+    size_t stop = led_str_len(&lpath);
+    size_t start = led_str_basename_zn(&lpath, 0, &stop);
+    size_t dir_len = led_str_dirname_zn(&lpath, 0, led_str_len(&lpath));
+
+    // the trailing slashes and the dot names are resolved by the libc
+    if (stop == start || stop != led_str_len(&lpath) || path[start] == '/'
+        || (path[start] == '.' && (stop - start == 1 || (stop - start == 2 && path[start+1] == '.'))))
+        return realpath(path, real) != NULL;
+
+    // the directory is resolved once, an empty one is the current directory
+    uint64_t hash = led_hash_xxh64(path, dir_len, 0);
+    if (!led.path) led.path = led_arena_alloc(&led.arena, LED_PATH_CACHE_MAX * sizeof(*led.path));
+    led_path_t* entry = &led.path[hash & (LED_PATH_CACHE_MAX - 1)];
+    if (entry->used && entry->hash == hash && entry->len == dir_len && !memcmp(entry->dir, path, dir_len))
+        led.report.path_cache_hit_count++;
+    else {
+        memcpy(entry->dir, path, dir_len);
+        entry->dir[dir_len] = '\0';
+        entry->hash = hash;
+        entry->len = dir_len;
+        entry->used = true;
+        entry->resolved = realpath(dir_len ? entry->dir : ".", entry->real) != NULL;
+        led.report.path_cache_miss_count++;
+    }
+    if (!entry->resolved) return false;
+
+    // the last name must exist and a link on it is left to the libc
+    size_t real_len = strlen(entry->real);
+    if (real_len + 1 + stop - start >= PATH_MAX) return realpath(path, real) != NULL;
+    memcpy(real, entry->real, real_len);
+    if (real_len > 1) real[real_len++] = '/';
+    memcpy(real + real_len, path + start, stop - start);
+    real[real_len + stop - start] = '\0';
+    struct stat st;
+    if (lstat(real, &st) < 0) return false;
+    if (S_ISLNK(st.st_mode)) return realpath(path, real) != NULL;
+    return true;
+}
+
 void led_fn_impl_realpath(led_fn_t* pfunc) {
-    led_zn_pre_process(pfunc);
+    char path[LED_FNAME_MAX+1];
+    char real[PATH_MAX];
 
-    char c = led.line_prep.buf[led.line_prep.zone_stop]; // temporary save this char for realpath function
-    led.line_prep.buf[led.line_prep.zone_stop] = '\0';
-    if (realpath(led_str_str_at(&led.line_prep.lstr, led.line_prep.zone_start), led.line_write.buf + led_str_len(&led.line_write.lstr)) != NULL ) {
-        led.line_prep.buf[led.line_prep.zone_stop] = c;
-        led_str_init_buf(&led.line_write.lstr, led.line_write.buf);
-    }
-    else {
-        led.line_prep.buf[led.line_prep.zone_stop] = c;
-        led_line_append_zn(&led.line_write, &led.line_prep);
+    led_zn_pre_process(pfunc);
+    size_t len = led.line_prep->zone_stop - led.line_prep->zone_start;
+    if (len <= LED_FNAME_MAX) {
+        memcpy(path, led_str_str_at(&led.line_prep->lstr, led.line_prep->zone_start), len);
+        path[len] = '\0';
     }
+    if (len <= LED_FNAME_MAX && led_fn_helper_realpath(path, real))
+        led_str_app_str(&led.line_write->lstr, real);
+    else
+        led_line_append_zn(led.line_write, led.line_prep);
     led_zn_post_process();
 }
 
 void led_fn_impl_dirname(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    const char* dir = dirname(led_str_str_at(&led.line_prep.lstr, led.line_prep.zone_start));
-    if (dir != NULL) led_str_app_str(&led.line_write.lstr, dir);
-    else led_line_append_zn(&led.line_write, &led.line_prep);
+    size_t stop = led_str_dirname_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop);
+    if (stop > led.line_prep->zone_start)
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, stop);
+    else
+        led_str_app_str(&led.line_write->lstr, ".");
 
     led_zn_post_process();
 }
@@ -593,9 +815,12 @@ void led_fn_impl_dirname(led_fn_t* pfunc) {
 void led_fn_impl_basename(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    const char* fname = basename(led_str_str_at(&led.line_prep.lstr, led.line_prep.zone_start));
-    if (fname != NULL) led_str_app_str(&led.line_write.lstr, fname);
-    else led_line_append_zn(&led.line_write, &led.line_prep);
+    size_t stop = led.line_prep->zone_stop;
+    size_t start = led_str_basename_zn(&led.line_prep->lstr, led.line_prep->zone_start, &stop);
+    if (stop > start)
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, start, stop);
+    else
+        led_str_app_str(&led.line_write->lstr, ".");
 
     led_zn_post_process();
 }
@@ -603,67 +828,299 @@ void led_fn_impl_basename(led_fn_t* pfunc) {
 void led_fn_impl_revert(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn_r(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+    led_str_foreach_uchar_zn_r(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop)
+        led_str_app_uchar(&led.line_write->lstr, foreach.uc);
+
+    led_zn_post_process();
+}
+
+#define LED_SEP_CSV ",;"
+#define LED_SEP_SPACE " \t\n"
+#define LED_SEP_MIXED ",; \t\n"
+
+void led_fn_impl_field_base(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+
+    const char* str = led_str_str(&led.line_prep->lstr);
+    size_t i = led.line_prep->zone_start;
+    size_t stop = led.line_prep->zone_stop;
+
+    // the first field starts at the zone start, the next ones after each run of separators
+    for (size_t n = 0; n < pfunc->arg[0].uval && i < stop; n++) {
+        i += led_str_find_set(str + i, stop - i, pfunc->uset);
+        i += led_str_span_set(str + i, stop - i, pfunc->uset);
+    }
+    if (i < stop)
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, i, i + led_str_find_set(str + i, stop - i, pfunc->uset));
 
     led_zn_post_process();
 }
 
-void led_fn_impl_field_base(led_fn_t* pfunc, const char* field_sep) {
+void led_fn_impl_field(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc); }
+void led_fn_impl_field_csv(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc); }
+void led_fn_impl_field_space(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc); }
+void led_fn_impl_field_mixed(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc); }
+
+void led_fn_config_field_project(led_fn_t* pfunc) {
+    const char* flist = led_str_str(&pfunc->arg[0].lstr);
+    const char* p = flist;
+    led_fn_config_uset(pfunc, led_str_str(&pfunc->arg[1].lstr));
+
+    // list of field indexes or ranges: N,N-N,N-
+    while (*p) {
+        char* end;
+        led_assert(led_uchar_isdigit((uint8_t)*p), LED_ERR_ARG, "Bad fields list: %s", flist);
+        led_assert(pfunc->frange_count < LED_FRANGE_MAX, LED_ERR_ARG, "Maximum fields list reached %d", LED_FRANGE_MAX);
+        size_t first = strtoul(p, &end, 10);
+        size_t last = first;
+        if (*end == '-') {
+            p = end + 1;
+            if (led_uchar_isdigit((uint8_t)*p)) last = strtoul(p, &end, 10);
+            else {
+                last = SIZE_MAX;
+                end = (char*)p;
+            }
+        }
+        led_assert(*end == ',' || *end == '\0', LED_ERR_ARG, "Bad fields list: %s", flist);
+        led_assert(first <= last, LED_ERR_ARG, "Bad fields range: %s", flist);
+        pfunc->frange[pfunc->frange_count].first = first;
+        pfunc->frange[pfunc->frange_count].last = last;
+        pfunc->frange_count++;
+        p = *end ? end + 1 : end;
+    }
+}
+
+void led_fn_impl_field_project(led_fn_t* pfunc) {
+    size_t fstart[LED_FIELD_MAX];
+    size_t fstop[LED_FIELD_MAX];
+    size_t fmax = 0;
+    size_t fcount = 0;
+
     led_zn_pre_process(pfunc);
 
-    led_str_decl_str(sepsval, field_sep);
-    size_t field_n = pfunc->arg[0].uval;
-    size_t n = 0;
-    bool was_sep = false;
+    // fields needed by the ranges
+    led_foreach_int(pfunc->frange_count)
+        if (pfunc->frange[foreach.i].last >= fmax)
+            fmax = pfunc->frange[foreach.i].last < LED_FIELD_MAX ? pfunc->frange[foreach.i].last + 1 : LED_FIELD_MAX;
+
+    // scan the field boundaries once
+    const char* str = led_str_str(&led.line_prep->lstr);
+    size_t i = led.line_prep->zone_start;
+    size_t stop = led.line_prep->zone_stop;
+    while (fcount < fmax && i < stop) {
+        fstart[fcount] = i;
+        i += led_str_find_set(str + i, stop - i, pfunc->uset);
+        fstop[fcount++] = i;
+        i += led_str_span_set(str + i, stop - i, pfunc->uset);
+    }
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop) {
-        bool is_sep = led_str_has_uchar(&sepsval, foreach.uc);
-        led_debug("i=%lu sep=%d was=%d char=%c n=%lu", foreach.i, is_sep, was_sep, foreach.uc, n);
-        if (was_sep && !is_sep) n++;
-        if (n == field_n) {
-            if (is_sep) break;
-            led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+    // then output the fields in the list order
+    bool first = true;
+    led_foreach_int(pfunc->frange_count) {
+        for (size_t f = pfunc->frange[foreach.i].first; f <= pfunc->frange[foreach.i].last && f < fcount; f++) {
+            if (!first) {
+                if (led_str_isinit(&pfunc->arg[2].lstr)) led_str_app(&led.line_write->lstr, &pfunc->arg[2].lstr);
+                else led_str_app_uchar(&led.line_write->lstr, led_str_uchar_first(&pfunc->arg[1].lstr));
+            }
+            led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, fstart[f], fstop[f]);
+            first = false;
         }
-        was_sep = is_sep;
     }
 
     led_zn_post_process();
 }
 
-void led_fn_impl_field(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc, led_str_str(&pfunc->arg[1].lstr)); }
-void led_fn_impl_field_csv(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc, ",;"); }
-void led_fn_impl_field_space(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc, " \t\n"); }
-void led_fn_impl_field_mixed(led_fn_t* pfunc) { led_fn_impl_field_base(pfunc, ",; \t\n"); }
+void led_fn_config_field_quoted(led_fn_t* pfunc) {
+    if (led_str_isinit(&pfunc->arg[1].lstr)) {
+        led_uchar_t sep = led_str_uchar_first(&pfunc->arg[1].lstr);
+        led_assert(sep < 0x80 && sep != '"' && led_str_len(&pfunc->arg[1].lstr) == 1, LED_ERR_ARG, "Bad CSV separator: %s", led_str_str(&pfunc->arg[1].lstr));
+    }
+}
+
+// CSV field checked as RFC 4180 and appended unquoted when app is set, malformed fields are appended as is
+bool led_fn_helper_csv_field(const char* str, size_t start, size_t stop, bool app) {
+    bool valid = true;
+    if (start < stop && str[start] == '"') {
+        // quoted field: closing quote at the end, inner quotes doubled
+        if (stop - start < 2 || str[stop - 1] != '"') valid = false;
+        for (size_t i = start + 1; valid && i < stop - 1; i++)
+            if (str[i] == '"' && (i + 1 >= stop - 1 || str[++i] != '"')) valid = false;
+        if (app && valid) {
+            for (size_t i = start + 1; i < stop - 1; i++) {
+                led_str_app_uchar(&led.line_write->lstr, str[i]);
+                if (str[i] == '"') i++;
+            }
+            return valid;
+        }
+    }
+    else if (memchr(str + start, '"', stop - start) != NULL)
+        valid = false;
+    if (app) led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, start, stop);
+    return valid;
+}
+
+void led_fn_impl_field_quoted(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+
+    const char* str = led_str_str(&led.line_prep->lstr);
+    char sep = led_str_isinit(&pfunc->arg[1].lstr) ? led_str_str(&pfunc->arg[1].lstr)[0] : ',';
+    size_t i = led.line_prep->zone_start;
+    size_t stop = led.line_prep->zone_stop;
+    bool quoted = false;
+    bool valid = true;
+
+    // empty fields count, separators inside quotes are skipped, the whole line is checked when reporting
+    for (size_t n = 0;; n++) {
+        size_t fstop = i + led_str_find_csv(str + i, stop - i, sep, &quoted);
+        if (n == pfunc->arg[0].uval || led.opt.report)
+            valid = led_fn_helper_csv_field(str, i, fstop, n == pfunc->arg[0].uval) && valid;
+        if (fstop >= stop || (n >= pfunc->arg[0].uval && !led.opt.report)) break;
+        i = fstop + 1;
+    }
+    if (!valid) led.report.line_malformed_count++;
+
+    led_zn_post_process();
+}
+
+void led_fn_impl_json_value(led_fn_t* pfunc) {
+    size_t start, stop;
+    const char* path = led_str_str(&pfunc->arg[0].lstr);
+
+    if (pfunc->arg_count > 1) {
+        // usecase with register ID argument, the value of the whole line goes to the register
+        size_t ir = pfunc->arg[1].uval;
+        led_assert(ir < LED_REG_MAX, LED_ERR_ARG, "Register ID %lu exeed maximum register ID %d", ir, LED_REG_MAX-1);
+        led_line_cpy(led.line_write, led.line_prep);
+        led_line_init(&led.line_reg[ir]);
+        if (led_json_find(led_str_str(&led.line_prep->lstr), led_str_len(&led.line_prep->lstr), path, &start, &stop))
+            led_str_app_json_zn(&led.line_reg[ir].lstr, &led.line_prep->lstr, start, stop);
+        return;
+    }
+
+    led_zn_pre_process(pfunc);
+
+    size_t zstart = led.line_prep->zone_start;
+    if (led_json_find(led_str_str_at(&led.line_prep->lstr, zstart), led.line_prep->zone_stop - zstart, path, &start, &stop))
+        led_str_app_json_zn(&led.line_write->lstr, &led.line_prep->lstr, zstart + start, zstart + stop);
+
+    led_zn_post_process();
+}
+
+void led_fn_helper_logfmt_split(size_t start, size_t stop) {
+    // the line is split once, the next functions reuse the spans while they read the same buffer
+    const char* str = led_str_str(&led.line_prep->lstr);
+    size_t len = led_str_len(&led.line_prep->lstr);
+    if (led.kv.str == str && led.kv.len == len && led.kv.zone_start == start && led.kv.zone_stop == stop)
+        return;
+    led_debug("led_fn_helper_logfmt_split: split zone start=%lu stop=%lu", start, stop);
+    led.kv.count = led_logfmt_split(led_str_str_at(&led.line_prep->lstr, start), stop - start, led.kv.span, LED_KV_MAX);
+    led_foreach_int(led.kv.count) {
+        led.kv.span[foreach.i].kstart += start;
+        led.kv.span[foreach.i].kstop += start;
+        led.kv.span[foreach.i].vstart += start;
+        led.kv.span[foreach.i].vstop += start;
+    }
+    led.kv.str = str;
+    led.kv.len = len;
+    led.kv.zone_start = start;
+    led.kv.zone_stop = stop;
+}
+
+void led_fn_helper_logfmt_app(led_str_t* lstr, const char* key, size_t klen) {
+    const char* str = led_str_str(&led.line_prep->lstr);
+    led_foreach_int(led.kv.count) {
+        led_kv_span_t* span = &led.kv.span[foreach.i];
+        if (span->kstop - span->kstart == klen && memcmp(str + span->kstart, key, klen) == 0) {
+            led_str_app_json_zn(lstr, &led.line_prep->lstr, span->vstart, span->vstop);
+            return;
+        }
+    }
+}
+
+void led_fn_impl_logfmt_value(led_fn_t* pfunc) {
+    const char* keys = led_str_str(&pfunc->arg[0].lstr);
+
+    if (pfunc->arg_count > 1) {
+        // usecase with register ID argument, the values of the keys go to the next registers
+        size_t ir = pfunc->arg[1].uval;
+        size_t start = 0;
+        size_t stop = led_str_len(&led.line_prep->lstr);
+        if (pfunc->regex) {
+            led_str_match_iter_reset(&pfunc->zn_iter);
+            if (led_str_match_iter_next(&pfunc->zn_iter, &led.line_prep->lstr)) {
+                start = pfunc->zn_iter.zone_start;
+                stop = pfunc->zn_iter.zone_stop;
+            }
+            else
+                start = stop;
+        }
+        led_fn_helper_logfmt_split(start, stop);
+        while (*keys) {
+            const char* kend = strchr(keys, ',');
+            if (kend == NULL) kend = keys + strlen(keys);
+            led_assert(ir < LED_REG_MAX, LED_ERR_ARG, "Register ID %lu exeed maximum register ID %d", ir, LED_REG_MAX-1);
+            led_line_init(&led.line_reg[ir]);
+            led_fn_helper_logfmt_app(&led.line_reg[ir].lstr, keys, kend - keys);
+            ir++;
+            keys = *kend ? kend + 1 : kend;
+        }
+        led_line_cpy(led.line_write, led.line_prep);
+        // the copied line is unchanged, the spans stay valid on the copy
+        led.kv.str = led_str_str(&led.line_write->lstr);
+        return;
+    }
+
+    led_zn_pre_process(pfunc);
+
+    led_fn_helper_logfmt_split(led.line_prep->zone_start, led.line_prep->zone_stop);
+    // values separated by a space
+    for (bool first = true; *keys; first = false) {
+        const char* kend = strchr(keys, ',');
+        if (kend == NULL) kend = keys + strlen(keys);
+        if (!first) led_str_app_uchar(&led.line_write->lstr, ' ');
+        led_fn_helper_logfmt_app(&led.line_write->lstr, keys, kend - keys);
+        keys = *kend ? kend + 1 : kend;
+    }
+
+    led_zn_post_process();
+}
 
 void led_fn_impl_join(led_fn_t* pfunc) {
     (void) pfunc;
-    led_str_foreach_uchar(&led.line_prep.lstr) {
-        if (foreach.uc != '\n') led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+    led_line_init(led.line_write);
+    led_str_foreach_uchar(&led.line_prep->lstr) {
+        if (foreach.uc != '\n') led_str_app_uchar(&led.line_write->lstr, foreach.uc);
     }
 }
 
-void led_fn_impl_split_base(led_fn_t* pfunc, const char* field_sep) {
-    led_str_decl_str(sepsval, field_sep);
+void led_fn_impl_split_base(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led_str_len(&led.line_prep.lstr)) {
-        if ( led_str_has_uchar(&sepsval, foreach.uc) ) foreach.uc = '\n';
-        led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+    const char* str = led_str_str(&led.line_prep->lstr);
+    size_t i = led.line_prep->zone_start;
+    size_t stop = led_str_len(&led.line_prep->lstr);
+
+    // copy the text between separators, each separator char becomes a new line
+    while (i < stop) {
+        size_t isep = i + led_str_find_set(str + i, stop - i, pfunc->uset);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, i, isep);
+        if (isep >= stop) break;
+        led_str_app_uchar(&led.line_write->lstr, '\n');
+        i = led_str_pos_uchar_next(&led.line_prep->lstr, isep);
     }
     led_zn_post_process();
 }
 
-void led_fn_impl_split(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc, led_str_str(&pfunc->arg[0].lstr)); }
-void led_fn_impl_split_space(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc, " \t\n"); }
-void led_fn_impl_split_csv(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc, ",;"); }
-void led_fn_impl_split_mixed(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc, ",; \t\n"); }
+void led_fn_impl_split(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc); }
+void led_fn_impl_split_space(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc); }
+void led_fn_impl_split_csv(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc); }
+void led_fn_impl_split_mixed(led_fn_t* pfunc) { led_fn_impl_split_base(pfunc); }
 
 void led_fn_impl_randomize_base(led_fn_t* pfunc, const char* charset, size_t len) {
     led_zn_pre_process(pfunc);
 
-    led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-        led_str_app_uchar(&led.line_write.lstr, charset[rand() % len]);
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop)
+        led_str_app_uchar(&led.line_write->lstr, charset[led_rand_index(&led.rand, len)]);
 
     led_zn_post_process();
 }
@@ -680,33 +1137,39 @@ void led_fn_impl_randomize_alnum(led_fn_t* pfunc) { led_fn_impl_randomize_base(p
 void led_fn_impl_randomize_hexa(led_fn_t* pfunc) { led_fn_impl_randomize_base(pfunc, randomize_table_hexa, sizeof randomize_table_hexa - 1); }
 void led_fn_impl_randomize_mixed(led_fn_t* pfunc) { led_fn_impl_randomize_base(pfunc, randomize_table_mixed, sizeof randomize_table_mixed - 1); }
 
+size_t led_fn_map_randomize_num(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) { (void) pfunc; (void) uc; ucout[0] = randomize_table_num[led_rand_index(&led.rand, sizeof randomize_table_num - 1)]; return 1; }
+size_t led_fn_map_randomize_alpha(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) { (void) pfunc; (void) uc; ucout[0] = randomize_table_alpha[led_rand_index(&led.rand, sizeof randomize_table_alpha - 1)]; return 1; }
+size_t led_fn_map_randomize_alnum(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) { (void) pfunc; (void) uc; ucout[0] = randomize_table_alnum[led_rand_index(&led.rand, sizeof randomize_table_alnum - 1)]; return 1; }
+size_t led_fn_map_randomize_hexa(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) { (void) pfunc; (void) uc; ucout[0] = randomize_table_hexa[led_rand_index(&led.rand, sizeof randomize_table_hexa - 1)]; return 1; }
+size_t led_fn_map_randomize_mixed(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) { (void) pfunc; (void) uc; ucout[0] = randomize_table_mixed[led_rand_index(&led.rand, sizeof randomize_table_mixed - 1)]; return 1; }
+
 size_t led_fn_helper_fname_pos() {
-    size_t iname = led_str_rfind_uchar_zn(&led.line_prep.lstr, '/', led.line_prep.zone_start, led.line_prep.zone_stop);
-    if (iname == led_str_len(&led.line_prep.lstr)) iname = led.line_prep.zone_start;
+    size_t iname = led_str_rfind_uchar_zn(&led.line_prep->lstr, '/', led.line_prep->zone_start, led.line_prep->zone_stop);
+    if (iname == led_str_len(&led.line_prep->lstr)) iname = led.line_prep->zone_start;
     else iname++;
-    led_debug("led_fn_helper_fname_pos: iname: %u %s", iname, led_str_str_at(&led.line_prep.lstr, iname));
+    led_debug("led_fn_helper_fname_pos: iname: %u %s", iname, led_str_str_at(&led.line_prep->lstr, iname));
     return iname;
 }
 
 void led_fn_impl_fname_lower(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    if (led.line_prep.zone_start < led.line_prep.zone_stop) {
+    if (led.line_prep->zone_start < led.line_prep->zone_stop) {
         size_t iname = led_fn_helper_fname_pos();
-        led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start, iname);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, iname);
 
-        led_str_foreach_uchar_zn(&led.line_prep.lstr, iname, led.line_prep.zone_stop) {
-            led_uchar_t luc = led_str_uchar_last(&led.line_write.lstr);
+        led_str_foreach_uchar_zn(&led.line_prep->lstr, iname, led.line_prep->zone_stop) {
+            led_uchar_t luc = led_str_uchar_last(&led.line_write->lstr);
             if (led_uchar_isalnum(foreach.uc))
-                led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
+                led_str_app_uchar(&led.line_write->lstr, led_uchar_tolower(foreach.uc));
             else if (foreach.uc == '.') {
                 if (!led_uchar_isalnum(luc))
-                    led_str_trunk_uchar_last(&led.line_write.lstr);
-                led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+                    led_str_trunk_uchar_last(&led.line_write->lstr);
+                led_str_app_uchar(&led.line_write->lstr, foreach.uc);
             }
             else {
                 if (led_uchar_isalnum(luc))
-                    led_str_app_uchar(&led.line_write.lstr, '_');
+                    led_str_app_uchar(&led.line_write->lstr, '_');
             }
         }
     }
@@ -716,22 +1179,22 @@ void led_fn_impl_fname_lower(led_fn_t* pfunc) {
 void led_fn_impl_fname_upper(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    if (led.line_prep.zone_start < led.line_prep.zone_stop) {
+    if (led.line_prep->zone_start < led.line_prep->zone_stop) {
         size_t iname = led_fn_helper_fname_pos();
-        led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start, iname);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, iname);
 
-        led_str_foreach_uchar_zn(&led.line_prep.lstr, iname, led.line_prep.zone_stop) {
-            led_uchar_t luc = led_str_uchar_last(&led.line_write.lstr);
+        led_str_foreach_uchar_zn(&led.line_prep->lstr, iname, led.line_prep->zone_stop) {
+            led_uchar_t luc = led_str_uchar_last(&led.line_write->lstr);
             if (led_uchar_isalnum(foreach.uc))
-                led_str_app_uchar(&led.line_write.lstr, led_uchar_toupper(foreach.uc));
+                led_str_app_uchar(&led.line_write->lstr, led_uchar_toupper(foreach.uc));
             else if (foreach.uc == '.') {
                 if (!led_uchar_isalnum(luc))
-                    led_str_trunk_uchar_last(&led.line_write.lstr);
-                led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+                    led_str_trunk_uchar_last(&led.line_write->lstr);
+                led_str_app_uchar(&led.line_write->lstr, foreach.uc);
             }
             else {
                 if (led_uchar_isalnum(luc))
-                    led_str_app_uchar(&led.line_write.lstr, '_');
+                    led_str_app_uchar(&led.line_write->lstr, '_');
             }
         }
     }
@@ -741,23 +1204,23 @@ void led_fn_impl_fname_upper(led_fn_t* pfunc) {
 void led_fn_impl_fname_camel(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    if (led.line_prep.zone_start < led.line_prep.zone_stop) {
+    if (led.line_prep->zone_start < led.line_prep->zone_stop) {
         size_t iname = led_fn_helper_fname_pos();
-        led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start, iname);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, iname);
 
         bool wasword = true;
         bool isfirst = true;
-        led_str_foreach_uchar_zn(&led.line_prep.lstr, iname, led.line_prep.zone_stop) {
-            led_uchar_t luc = led_str_uchar_last(&led.line_write.lstr);
+        led_str_foreach_uchar_zn(&led.line_prep->lstr, iname, led.line_prep->zone_stop) {
+            led_uchar_t luc = led_str_uchar_last(&led.line_write->lstr);
             if (led_uchar_isalnum(luc) && foreach.uc == '.') {
-                led_str_app_uchar(&led.line_write.lstr, foreach.uc);
+                led_str_app_uchar(&led.line_write->lstr, foreach.uc);
                 isfirst = true;
             }
             else {
                 bool isword = led_uchar_isalnum(foreach.uc);
                 if (isword) {
-                    if (wasword || isfirst) led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
-                    else led_str_app_uchar(&led.line_write.lstr, led_uchar_toupper(foreach.uc));
+                    if (wasword || isfirst) led_str_app_uchar(&led.line_write->lstr, led_uchar_tolower(foreach.uc));
+                    else led_str_app_uchar(&led.line_write->lstr, led_uchar_toupper(foreach.uc));
                     isfirst = false;
                 }
                 wasword = isword;
@@ -770,28 +1233,34 @@ void led_fn_impl_fname_camel(led_fn_t* pfunc) {
 void led_fn_impl_fname_snake(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
-    if (led.line_prep.zone_start < led.line_prep.zone_stop) {
+    if (led.line_prep->zone_start < led.line_prep->zone_stop) {
         size_t iname = led_fn_helper_fname_pos();
-        led_str_app_zn(&led.line_write.lstr, &led.line_prep.lstr, led.line_prep.zone_start, iname);
+        led_str_app_zn(&led.line_write->lstr, &led.line_prep->lstr, led.line_prep->zone_start, iname);
 
-        led_str_foreach_uchar_zn(&led.line_prep.lstr, iname, led.line_prep.zone_stop) {
-            led_uchar_t luc = led_str_uchar_last(&led.line_write.lstr);
+        led_str_foreach_uchar_zn(&led.line_prep->lstr, iname, led.line_prep->zone_stop) {
+            led_uchar_t luc = led_str_uchar_last(&led.line_write->lstr);
             if (led_uchar_isalnum(foreach.uc))
-                led_str_app_uchar(&led.line_write.lstr, led_uchar_tolower(foreach.uc));
+                led_str_app_uchar(&led.line_write->lstr, led_uchar_tolower(foreach.uc));
             else if (foreach.uc == '.') {
-                led_str_trunk_uchar(&led.line_write.lstr, '.');
-                led_str_trunk_uchar(&led.line_write.lstr, '_');
-                led_str_app_uchar(&led.line_write.lstr, '.');
+                led_str_trunk_uchar(&led.line_write->lstr, '.');
+                led_str_trunk_uchar(&led.line_write->lstr, '_');
+                led_str_app_uchar(&led.line_write->lstr, '.');
             }
             else if (luc != '\0' && luc != '.') {
-                led_str_trunk_uchar(&led.line_write.lstr, '_');
-                led_str_app_uchar(&led.line_write.lstr, '_');
+                led_str_trunk_uchar(&led.line_write->lstr, '_');
+                led_str_app_uchar(&led.line_write->lstr, '_');
             }
         }
     }
     led_zn_post_process();
 }
 
+size_t led_fn_map_generate(led_fn_t* pfunc, led_uchar_t uc, led_uchar_t* ucout) {
+    (void) uc;
+    ucout[0] = led_str_uchar_first(&pfunc->arg[0].lstr);
+    return 1;
+}
+
 void led_fn_impl_generate(led_fn_t* pfunc) {
     led_zn_pre_process(pfunc);
 
@@ -799,67 +1268,275 @@ void led_fn_impl_generate(led_fn_t* pfunc) {
 
     if ( pfunc->arg[1].uval > 0  ) {
         led_foreach_int(pfunc->arg[1].uval)
-            led_str_app_uchar(&led.line_write.lstr, cdup);
+            led_str_app_uchar(&led.line_write->lstr, cdup);
+    }
+    else {
+        led_str_foreach_uchar_zn(&led.line_prep->lstr, led.line_prep->zone_start, led.line_prep->zone_stop)
+            led_str_app_uchar(&led.line_write->lstr, cdup);
+    }
+
+    led_zn_post_process();
+}
+
+//-----------------------------------------------
+// LED functions configuration
+//-----------------------------------------------
+
+void led_fn_config_aes(led_fn_t* pfunc) {
+    // key source is an environment variable when prefixed by $, a file otherwise
+    const char* src = led_str_str(&pfunc->arg[0].lstr);
+    char buf[LED_BUF_MAX];
+    size_t len = 0;
+    if (src[0] == '$') {
+        const char* val = getenv(src + 1);
+        led_assert(val != NULL, LED_ERR_ARG, "Key variable not found: %s", src + 1);
+        len = strnlen(val, LED_BUF_MAX);
+        memcpy(buf, val, len);
     }
     else {
-        led_str_foreach_uchar_zn(&led.line_prep.lstr, led.line_prep.zone_start, led.line_prep.zone_stop)
-            led_str_app_uchar(&led.line_write.lstr, cdup);
+        FILE* file = fopen(src, "r");
+        led_assert(file != NULL, LED_ERR_FILE, "Key file not found: %s", src);
+        len = fread(buf, 1, LED_BUF_MAX, file);
+        fclose(file);
     }
+    while (len && led_uchar_isspace(buf[len - 1])) len--;
+    led_assert(len > 0, LED_ERR_ARG, "Empty key: %s", src);
+
+    // 64 hex digits are the raw key, any other content is hashed to a key
+    uint8_t key[LED_AES_KEY_LEN];
+    bool ishex = len == 2 * LED_AES_KEY_LEN;
+    for (size_t i = 0; ishex && i < len; i++) ishex = led_hex_val(buf[i]) < 0x10;
+    if (ishex)
+        led_foreach_int(LED_AES_KEY_LEN) key[foreach.i] = led_hex_val(buf[2*foreach.i]) << 4 | led_hex_val(buf[2*foreach.i+1]);
+    else {
+        led_hash_init();
+        led_hash_sha256(buf, len, key);
+    }
+    pfunc->aes = led_arena_alloc(&led.arena, sizeof(led_aes_t));
+    led_aes_init(pfunc->aes, key);
+    memset(key, 0, sizeof key);
+    memset(buf, 0, len);
+}
+
+void led_fn_config_dedup(led_fn_t* pfunc, bool exact) {
+    // the whole line is kept or deleted, it is not split in zones
+    led_assert(!led.opt.output_match_all, LED_ERR_ARG, "Dedup does not apply in all matches mode (-M)");
+    // optional memory cap in KB, rounded down to a power of 2 fingerprints
+    size_t size_max = LED_DEDUP_MAX;
+    if (pfunc->arg[0].uval) {
+        size_t count = pfunc->arg[0].uval * 1024 / sizeof(uint64_t);
+        for (size_max = LED_DEDUP_MIN; size_max * 2 <= count && size_max < LED_DEDUP_MAX; size_max *= 2);
+    }
+    led_dedup_init(&led.dedup, exact, size_max);
+}
+
+void led_fn_config_sort(led_fn_t* pfunc) {
+    led_assert(pfunc == &led.func_list[led.func_count - 1], LED_ERR_ARG, "Sort must be the last function");
+    // the line is sorted once on its first zone, it is not split in zones
+    led_assert(!led.opt.output_match_all, LED_ERR_ARG, "Sort does not apply in all matches mode (-M)");
+    bool numeric = false;
+    bool reverse = false;
+    if (led_str_isinit(&pfunc->arg[0].lstr))
+        led_foreach_char(led_str_str(&pfunc->arg[0].lstr)) {
+            if (foreach.c == 'n') numeric = true;
+            else if (foreach.c == 'r') reverse = true;
+            else led_assert(false, LED_ERR_ARG, "Bad sort option: %c", foreach.c);
+        }
+    // memory budget in MB
+    led_sort_init(&led.sort, pfunc->arg[1].uval ? pfunc->arg[1].uval << 20 : LED_SORT_MEM_DEFAULT, numeric, reverse);
+}
+
+void led_fn_config(led_fn_t* pfunc) {
+    // precompute the function data from its arguments
+    led_fn_impl impl = led_fn_table_descriptor(pfunc->id)->impl;
+    if (impl == &led_fn_impl_translate)
+        led_fn_config_translate(pfunc);
+    else if (impl == &led_fn_impl_field)
+        led_fn_config_uset(pfunc, led_str_str(&pfunc->arg[1].lstr));
+    else if (impl == &led_fn_impl_field_project)
+        led_fn_config_field_project(pfunc);
+    else if (impl == &led_fn_impl_field_quoted)
+        led_fn_config_field_quoted(pfunc);
+    else if (impl == &led_fn_impl_hash_crc32c || impl == &led_fn_impl_hash_xxh64 || impl == &led_fn_impl_hash_sha256)
+        led_hash_init();
+    else if (impl == &led_fn_impl_aes_encrypt || impl == &led_fn_impl_aes_decrypt)
+        led_fn_config_aes(pfunc);
+    else if (impl == &led_fn_impl_dedup || impl == &led_fn_impl_dedup_exact)
+        led_fn_config_dedup(pfunc, impl == &led_fn_impl_dedup_exact);
+    else if (impl == &led_fn_impl_sort)
+        led_fn_config_sort(pfunc);
+    else if (impl == &led_fn_impl_split)
+        led_fn_config_uset(pfunc, led_str_str(&pfunc->arg[0].lstr));
+    else if (impl == &led_fn_impl_field_csv || impl == &led_fn_impl_split_csv)
+        led_fn_config_uset(pfunc, LED_SEP_CSV);
+    else if (impl == &led_fn_impl_field_space || impl == &led_fn_impl_split_space)
+        led_fn_config_uset(pfunc, LED_SEP_SPACE);
+    else if (impl == &led_fn_impl_field_mixed || impl == &led_fn_impl_split_mixed)
+        led_fn_config_uset(pfunc, LED_SEP_MIXED);
+}
+
+//-----------------------------------------------
+// LED fused functions
+//-----------------------------------------------
+
+bool led_fn_isfusable(led_fn_t* pfunc) {
+    led_fn_desc_t* pfn_desc = led_fn_table_descriptor(pfunc->id);
+    // only functions on the whole line, generate with a count does not map chars
+    return !pfunc->regex && (pfn_desc->map || pfn_desc->trim) && !(pfn_desc->map == &led_fn_map_generate && pfunc->arg[1].uval > 0);
+}
+
+bool led_fn_ispure(led_fn_t* pfunc) {
+    led_fn_impl impl = led_fn_table_descriptor(pfunc->id)->impl;
+    // the result must depend on the line only: no random, no state kept between lines, no register read
+    led_foreach_int(pfunc->arg_count)
+        if (memmem(led_str_str(&pfunc->arg[foreach.i].lstr), led_str_len(&pfunc->arg[foreach.i].lstr), "$R", 2))
+            return false;
+    return impl != &led_fn_impl_register_recall
+        && impl != &led_fn_impl_aes_encrypt
+        && impl != &led_fn_impl_dedup && impl != &led_fn_impl_dedup_exact
+        && impl != &led_fn_impl_sort
+        && impl != &led_fn_impl_randomize_num && impl != &led_fn_impl_randomize_alpha && impl != &led_fn_impl_randomize_alnum
+        && impl != &led_fn_impl_randomize_hexa && impl != &led_fn_impl_randomize_mixed;
+}
+
+bool led_fn_iszone(led_fn_t* pfunc) {
+    led_fn_impl impl = led_fn_table_descriptor(pfunc->id)->impl;
+    // the functions changing the matching zone only, the other ones work on the whole line
+    return impl != &led_fn_impl_register && impl != &led_fn_impl_register_recall
+        && impl != &led_fn_impl_substitute
+        && impl != &led_fn_impl_delete && impl != &led_fn_impl_delete_blank
+        && impl != &led_fn_impl_dedup && impl != &led_fn_impl_dedup_exact
+        && impl != &led_fn_impl_sort
+        && impl != &led_fn_impl_insert && impl != &led_fn_impl_append
+        && impl != &led_fn_impl_range_sel && impl != &led_fn_impl_range_unsel
+        && impl != &led_fn_impl_join;
+}
+
+bool led_fn_isstreamable(led_fn_t* pfunc) {
+    led_fn_desc_t* pfn_desc = led_fn_table_descriptor(pfunc->id);
+    // functions on the whole block giving the same result chunk by chunk, fused runs are led by a char map
+    return !pfunc->regex && (
+        pfn_desc->impl == &led_fn_impl_join
+        || pfn_desc->impl == &led_fn_impl_base64_encode || pfn_desc->impl == &led_fn_impl_base64url_encode
+        || pfn_desc->impl == &led_fn_impl_base64_decode
+        || pfn_desc->impl == &led_fn_impl_hex_encode || pfn_desc->impl == &led_fn_impl_hex_decode
+        || (pfn_desc->map && led_fn_isfusable(pfunc)));
+}
+
+size_t led_fn_stream_cut(led_fn_t* pfunc, char* str, size_t* len) {
+    led_fn_impl impl = led_fn_table_descriptor(pfunc->id)->impl;
+    if (impl == &led_fn_impl_base64_encode || impl == &led_fn_impl_base64url_encode)
+        return *len - *len % 3;
+    else if (impl == &led_fn_impl_base64_decode)
+        return led_str_unbase64_cut(str, len);
+    else if (impl == &led_fn_impl_hex_encode)
+        return *len;
+    else if (impl == &led_fn_impl_hex_decode)
+        return led_str_unhex_cut(str, len);
+    return led_uchar_pos_cut(str, *len);
+}
+
+void led_fn_fused_app(led_fn_t* pfunc, size_t count, led_uchar_t uc) {
+    if (count == 0) {
+        led_str_app_uchar(&led.line_write->lstr, uc);
+        return;
+    }
+    led_uchar_t ucout[LED_FN_MAP_MAX];
+    size_t n = led_fn_table_descriptor(pfunc->id)->map(pfunc, uc, ucout);
+    led_foreach_int(n)
+        led_fn_fused_app(pfunc + 1, count - 1, ucout[foreach.i]);
+}
+
+void led_fn_impl_fused(led_fn_t* pfunc) {
+    led_zn_pre_process(pfunc);
+
+    size_t count = pfunc->fused_count + 1;
+    size_t start = led.line_prep->zone_start;
+    size_t stop = led.line_prep->zone_stop;
+
+    // leading trims only move the zone boundaries
+    size_t ifn = 0;
+    for (; ifn < count && led_fn_table_descriptor(pfunc[ifn].id)->trim; ifn++) {
+        int trim = led_fn_table_descriptor(pfunc[ifn].id)->trim;
+        if (trim & LED_FN_TRIM_LEFT) start = led_fn_helper_trim_left_pos(start, stop);
+        if (trim & LED_FN_TRIM_RIGHT) stop = led_fn_helper_trim_right_pos(start, stop);
+    }
+
+    // then the char mappings are composed in one decoding pass
+    led_str_foreach_uchar_zn(&led.line_prep->lstr, start, stop)
+        led_fn_fused_app(pfunc + ifn, count - ifn, foreach.uc);
 
     led_zn_post_process();
 }
 
 led_fn_desc_t LED_FN_TABLE[] = {
-    { "s", "substitute", &led_fn_impl_substitute, "Ss", "Substitute", "s/[regex]/replace[/opts]" },
-    { "d", "delete", &led_fn_impl_delete, "", "Delete line", "d/" },
-    { "i", "insert", &led_fn_impl_insert, "Sp", "Insert line", "i/[regex]/<string>[/N]" },
-    { "a", "append", &led_fn_impl_append, "Sp", "Append line", "a/[regex]/<string>[/N]" },
-    { "j", "join", &led_fn_impl_join, "", "Join lines (only with pack mode)", "j/" },
-    { "db", "delete_blank", &led_fn_impl_delete_blank, "", "Delete blank/empty lines", "db/" },
-    { "tr", "translate", &led_fn_impl_translate, "SS", "Translate", "tr/[regex]/chars/chars" },
-    { "cl", "case_lower", &led_fn_impl_case_lower, "", "Case to lower", "cl/[regex]" },
-    { "cu", "case_upper", &led_fn_impl_case_upper, "", "Case to upper", "cu/[regex]" },
-    { "cf", "case_first", &led_fn_impl_case_first, "", "Case first upper", "cf/[regex]" },
-    { "cc", "case_camel", &led_fn_impl_case_camel, "", "Case to camel style", "cc/[regex]" },
-    { "cs", "case_snake", &led_fn_impl_case_snake, "", "Case to snake style", "cs/[regex]" },
-    { "qt", "quote_simple", &led_fn_impl_quote_simple, "", "Quote simple", "qt/[regex]" },
-    { "qtd", "quote_double", &led_fn_impl_quote_double, "", "Quote double", "qtd/[regex]" },
-    { "qtb", "quote_back", &led_fn_impl_quote_back, "", "Quote back", "qtb/[regex]" },
-    { "qtr", "quote_remove", &led_fn_impl_quote_remove, "", "Quote remove", "qtr/[regex]" },
-    { "sp", "split", &led_fn_impl_split, "S", "Split using characters", "sp/[regex]/chars" },
-    { "spc", "split_csv", &led_fn_impl_split_csv, "", "Split using comma", "spc/[regex]" },
-    { "sps", "split_space", &led_fn_impl_split_space, "", "Split using space", "sps/[regex]" },
-    { "spm", "split_mixed", &led_fn_impl_split_mixed, "", "Split using comma and space", "spm/[regex]" },
-    { "tm", "trim", &led_fn_impl_trim, "", "Trim", "tm/[regex]" },
-    { "tml", "trim_left", &led_fn_impl_trim_left, "", "Trim left", "tml/[regex]" },
-    { "tmr", "trim_right", &led_fn_impl_trim_right, "", "Trim right", "tmr/[regex]" },
-    { "rv", "revert", &led_fn_impl_revert, "", "Revert", "rv/[regex]" },
-    { "fld", "field", &led_fn_impl_field, "PSp", "Extract field with separator chars", "fld/[regex]/N/sep[/count]" },
-    { "fls", "field_space", &led_fn_impl_field_space, "Pp", "Extract field separated by space", "fls/[regex]/N[/count]" },
-    { "flc", "field_csv", &led_fn_impl_field_csv, "Pp", "Extract field separated by comma", "flc/[regex]/N[/count]" },
-    { "flm", "field_mixed", &led_fn_impl_field_mixed, "Pp", "Extract field separated by space or comma", "flm/[regex]/N[/count]" },
-    { "b64e", "base64_encode", &led_fn_impl_base64_encode, "", "Encode base64", "b64e/[regex]" },
-    { "b64d", "base64_decode", &led_fn_impl_base64_decode, "", "Decode base64", "b64d/[regex]" },
-    { "urle", "url_encode", &led_fn_impl_url_encode, "", "Encode URL", "urle/[regex]" },
-    { "she", "shell_escape", &led_fn_impl_shell_escape, "", "Shell escape", "she/[regex]" },
-    { "shu", "shell_unescape", &led_fn_impl_shell_unescape, "", "Shell un-escape", "shu/[regex]" },
-    { "rp", "realpath", &led_fn_impl_realpath, "", "Convert to real path (canonical)", "rp/[regex]" },
-    { "dn", "dirname", &led_fn_impl_dirname, "", "Extract last dir of the path", "dn/[regex]" },
-    { "bn", "basename", &led_fn_impl_basename, "", "Extract file of the path", "bn/[regex]" },
-    { "fnl", "fname_lower", &led_fn_impl_fname_lower, "", "simplify file name using lower case", "fnl/[regex]" },
-    { "fnu", "fname_upper", &led_fn_impl_fname_upper, "", "simplify file name using upper case", "fnu/[regex]" },
-    { "fnc", "fname_camel", &led_fn_impl_fname_camel, "", "simplify file name using camel case", "fnc/[regex]" },
-    { "fns", "fname_snake", &led_fn_impl_fname_snake, "", "simplify file name using snake case", "fnc/[regex]" },
-    { "rzn", "randomize_num", &led_fn_impl_randomize_num, "", "Randomize numeric values", "rzn/[regex]" },
-    { "rza", "randomize_alpha", &led_fn_impl_randomize_alpha, "", "Randomize alpha values", "rza/[regex]" },
-    { "rzan", "randomize_alnum", &led_fn_impl_randomize_alnum, "", "Randomize alpha numeric values", "rzan/[regex]" },
-    { "rzh", "randomize_hexa", &led_fn_impl_randomize_hexa, "", "Randomize alpha numeric values", "rzh/[regex]" },
-    { "rzm", "randomize_mixed", &led_fn_impl_randomize_mixed, "", "Randomize alpha numeric and custom chars", "rzm/[regex]" },
-    { "gen", "generate", &led_fn_impl_generate, "Sp", "Generate chars", "gen/[regex]/<char>[/N]" },
-    { "rn", "range_sel", &led_fn_impl_range_sel, "Np", "Range select", "rn/[regex]/start[/count]" },
-    { "rnu", "range_unsel", &led_fn_impl_range_unsel, "Np", "Range unselect", "rnu/[regex]/start[/count]" },
-    { "r", "register", &led_fn_impl_register, "p", "Register line content", "r/[regex][/N]" },
-    { "rr", "register_recall", &led_fn_impl_register_recall, "p", "Register recall to line", "rr/[regex][/N]" },
+    { "s", "substitute", &led_fn_impl_substitute, "Ss", "Substitute", "s/[regex]/replace[/opts]", NULL, 0 },
+    { "d", "delete", &led_fn_impl_delete, "", "Delete line", "d/", NULL, 0 },
+    { "i", "insert", &led_fn_impl_insert, "Sp", "Insert line", "i/[regex]/<string>[/N]", NULL, 0 },
+    { "a", "append", &led_fn_impl_append, "Sp", "Append line", "a/[regex]/<string>[/N]", NULL, 0 },
+    { "j", "join", &led_fn_impl_join, "", "Join lines (only with pack mode)", "j/", NULL, 0 },
+    { "db", "delete_blank", &led_fn_impl_delete_blank, "", "Delete blank/empty lines", "db/", NULL, 0 },
+    { "dd", "dedup", &led_fn_impl_dedup, "p", "Delete duplicate lines or zones", "dd/[regex][/max_kb]", NULL, 0 },
+    { "dde", "dedup_exact", &led_fn_impl_dedup_exact, "", "Delete duplicate lines or zones, exact compare", "dde/[regex]", NULL, 0 },
+    { "so", "sort", &led_fn_impl_sort, "sp", "Sort lines or blocks, last function only", "so/[regex][/opts][/max_mb]", NULL, 0 },
+    { "tr", "translate", &led_fn_impl_translate, "SS", "Translate", "tr/[regex]/chars/chars", &led_fn_map_translate, 0 },
+    { "cl", "case_lower", &led_fn_impl_case_lower, "", "Case to lower", "cl/[regex]", &led_fn_map_case_lower, 0 },
+    { "cu", "case_upper", &led_fn_impl_case_upper, "", "Case to upper", "cu/[regex]", &led_fn_map_case_upper, 0 },
+    { "cf", "case_first", &led_fn_impl_case_first, "", "Case first upper", "cf/[regex]", NULL, 0 },
+    { "cc", "case_camel", &led_fn_impl_case_camel, "", "Case to camel style", "cc/[regex]", NULL, 0 },
+    { "cs", "case_snake", &led_fn_impl_case_snake, "", "Case to snake style", "cs/[regex]", NULL, 0 },
+    { "qt", "quote_simple", &led_fn_impl_quote_simple, "", "Quote simple", "qt/[regex]", NULL, 0 },
+    { "qtd", "quote_double", &led_fn_impl_quote_double, "", "Quote double", "qtd/[regex]", NULL, 0 },
+    { "qtb", "quote_back", &led_fn_impl_quote_back, "", "Quote back", "qtb/[regex]", NULL, 0 },
+    { "qtr", "quote_remove", &led_fn_impl_quote_remove, "", "Quote remove", "qtr/[regex]", NULL, 0 },
+    { "sp", "split", &led_fn_impl_split, "S", "Split using characters", "sp/[regex]/chars", NULL, 0 },
+    { "spc", "split_csv", &led_fn_impl_split_csv, "", "Split using comma", "spc/[regex]", NULL, 0 },
+    { "sps", "split_space", &led_fn_impl_split_space, "", "Split using space", "sps/[regex]", NULL, 0 },
+    { "spm", "split_mixed", &led_fn_impl_split_mixed, "", "Split using comma and space", "spm/[regex]", NULL, 0 },
+    { "tm", "trim", &led_fn_impl_trim, "", "Trim", "tm/[regex]", NULL, LED_FN_TRIM_LEFT|LED_FN_TRIM_RIGHT },
+    { "tml", "trim_left", &led_fn_impl_trim_left, "", "Trim left", "tml/[regex]", NULL, LED_FN_TRIM_LEFT },
+    { "tmr", "trim_right", &led_fn_impl_trim_right, "", "Trim right", "tmr/[regex]", NULL, LED_FN_TRIM_RIGHT },
+    { "rv", "revert", &led_fn_impl_revert, "", "Revert", "rv/[regex]", NULL, 0 },
+    { "fld", "field", &led_fn_impl_field, "PSp", "Extract field with separator chars", "fld/[regex]/N/sep[/count]", NULL, 0 },
+    { "fls", "field_space", &led_fn_impl_field_space, "Pp", "Extract field separated by space", "fls/[regex]/N[/count]", NULL, 0 },
+    { "flc", "field_csv", &led_fn_impl_field_csv, "Pp", "Extract field separated by comma", "flc/[regex]/N[/count]", NULL, 0 },
+    { "flm", "field_mixed", &led_fn_impl_field_mixed, "Pp", "Extract field separated by space or comma", "flm/[regex]/N[/count]", NULL, 0 },
+    { "flp", "field_project", &led_fn_impl_field_project, "SSs", "Extract fields list with separator chars", "flp/[regex]/N,N-N,.../sep[/outsep]", NULL, 0 },
+    { "flq", "field_quoted", &led_fn_impl_field_quoted, "Ps", "Extract CSV field with quotes (RFC 4180)", "flq/[regex]/N[/sep]", NULL, 0 },
+    { "jsv", "json_value", &led_fn_impl_json_value, "Sp", "Extract JSON value by key path", "jsv/[regex]/key.path[/N]", NULL, 0 },
+    { "lfv", "logfmt_value", &led_fn_impl_logfmt_value, "Sp", "Extract logfmt values by keys", "lfv/[regex]/key[,key...][/N]", NULL, 0 },
+    { "b64e", "base64_encode", &led_fn_impl_base64_encode, "", "Encode base64", "b64e/[regex]", NULL, 0 },
+    { "b64d", "base64_decode", &led_fn_impl_base64_decode, "", "Decode base64", "b64d/[regex]", NULL, 0 },
+    { "b64ue", "base64url_encode", &led_fn_impl_base64url_encode, "", "Encode base64 with URL alphabet", "b64ue/[regex]", NULL, 0 },
+    { "b64ud", "base64url_decode", &led_fn_impl_base64_decode, "", "Decode base64 with URL alphabet", "b64ud/[regex]", NULL, 0 },
+    { "hxe", "hex_encode", &led_fn_impl_hex_encode, "", "Encode hexadecimal", "hxe/[regex]", NULL, 0 },
+    { "hxd", "hex_decode", &led_fn_impl_hex_decode, "", "Decode hexadecimal", "hxd/[regex]", NULL, 0 },
+    { "hcrc", "hash_crc32c", &led_fn_impl_hash_crc32c, "", "Hash CRC32C hex digest", "hcrc/[regex]", NULL, 0 },
+    { "hxxh", "hash_xxh64", &led_fn_impl_hash_xxh64, "", "Hash xxHash64 hex digest", "hxxh/[regex]", NULL, 0 },
+    { "hsha", "hash_sha256", &led_fn_impl_hash_sha256, "", "Hash SHA-256 hex digest", "hsha/[regex]", NULL, 0 },
+    { "aese", "aes_encrypt", &led_fn_impl_aes_encrypt, "S", "AES-256-GCM encrypt to base64", "aese/[regex]/key_file|$key_var", NULL, 0 },
+    { "aesd", "aes_decrypt", &led_fn_impl_aes_decrypt, "S", "AES-256-GCM decrypt from base64", "aesd/[regex]/key_file|$key_var", NULL, 0 },
+    { "urle", "url_encode", &led_fn_impl_url_encode, "", "Encode URL", "urle/[regex]", NULL, 0 },
+    { "urld", "url_decode", &led_fn_impl_url_decode, "", "Decode URL", "urld/[regex]", NULL, 0 },
+    { "she", "shell_escape", &led_fn_impl_shell_escape, "", "Shell escape", "she/[regex]", &led_fn_map_shell_escape, 0 },
+    { "shu", "shell_unescape", &led_fn_impl_shell_unescape, "", "Shell un-escape", "shu/[regex]", NULL, 0 },
+    { "rp", "realpath", &led_fn_impl_realpath, "", "Convert to real path (canonical)", "rp/[regex]", NULL, 0 },
+    { "dn", "dirname", &led_fn_impl_dirname, "", "Extract last dir of the path", "dn/[regex]", NULL, 0 },
+    { "bn", "basename", &led_fn_impl_basename, "", "Extract file of the path", "bn/[regex]", NULL, 0 },
+    { "fnl", "fname_lower", &led_fn_impl_fname_lower, "", "simplify file name using lower case", "fnl/[regex]", NULL, 0 },
+    { "fnu", "fname_upper", &led_fn_impl_fname_upper, "", "simplify file name using upper case", "fnu/[regex]", NULL, 0 },
+    { "fnc", "fname_camel", &led_fn_impl_fname_camel, "", "simplify file name using camel case", "fnc/[regex]", NULL, 0 },
+    { "fns", "fname_snake", &led_fn_impl_fname_snake, "", "simplify file name using snake case", "fnc/[regex]", NULL, 0 },
+    { "rzn", "randomize_num", &led_fn_impl_randomize_num, "", "Randomize numeric values", "rzn/[regex]", &led_fn_map_randomize_num, 0 },
+    { "rza", "randomize_alpha", &led_fn_impl_randomize_alpha, "", "Randomize alpha values", "rza/[regex]", &led_fn_map_randomize_alpha, 0 },
+    { "rzan", "randomize_alnum", &led_fn_impl_randomize_alnum, "", "Randomize alpha numeric values", "rzan/[regex]", &led_fn_map_randomize_alnum, 0 },
+    { "rzh", "randomize_hexa", &led_fn_impl_randomize_hexa, "", "Randomize alpha numeric values", "rzh/[regex]", &led_fn_map_randomize_hexa, 0 },
+    { "rzm", "randomize_mixed", &led_fn_impl_randomize_mixed, "", "Randomize alpha numeric and custom chars", "rzm/[regex]", &led_fn_map_randomize_mixed, 0 },
+    { "gen", "generate", &led_fn_impl_generate, "Sp", "Generate chars", "gen/[regex]/<char>[/N]", &led_fn_map_generate, 0 },
+    { "rn", "range_sel", &led_fn_impl_range_sel, "Np", "Range select", "rn/[regex]/start[/count]", NULL, 0 },
+    { "rnu", "range_unsel", &led_fn_impl_range_unsel, "Np", "Range unselect", "rnu/[regex]/start[/count]", NULL, 0 },
+    { "r", "register", &led_fn_impl_register, "p", "Register line content", "r/[regex][/N]", NULL, 0 },
+    { "rr", "register_recall", &led_fn_impl_register_recall, "p", "Register recall to line", "rr/[regex][/N]", NULL, 0 },
 };
 
 #define LED_FN_TABLE_MAX sizeof(LED_FN_TABLE)/sizeof(led_fn_desc_t)
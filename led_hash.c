@@ -0,0 +1,476 @@
+/***************************************************************************
+ Copyright (C) 2024 - Olivier ROUITS <olivier.rouits@free.fr>
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ USA
+ ***************************************************************************/
+
+#include "led.h"
+#include <sys/mman.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LED_HASH_X86
+#endif
+
+//-----------------------------------------------
+// LED hash runtime init: hardware paths are selected once when available
+//-----------------------------------------------
+
+bool led_hash_crc32c_hw;
+bool led_hash_sha256_hw;
+uint32_t led_hash_crc32c_table[0x100];
+
+void led_hash_init() {
+    if (led_hash_crc32c_table[1]) return;
+
+    // CRC32C reflected polynomial
+    led_foreach_int(0x100) {
+        uint32_t crc = foreach.i;
+        for (int k = 0; k < 8; k++)
+            crc = crc & 1 ? (crc >> 1) ^ 0x82F63B78 : crc >> 1;
+        led_hash_crc32c_table[foreach.i] = crc;
+    }
+#ifdef LED_HASH_X86
+    __builtin_cpu_init();
+    led_hash_crc32c_hw = __builtin_cpu_supports("sse4.2");
+    led_hash_sha256_hw = __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+#endif
+    led_debug("led_hash_init: crc32c hw=%d sha256 hw=%d", led_hash_crc32c_hw, led_hash_sha256_hw);
+}
+
+//-----------------------------------------------
+// LED CRC32C
+//-----------------------------------------------
+
+#ifdef LED_HASH_X86
+__attribute__((target("sse4.2")))
+uint32_t led_hash_crc32c_sse42(uint32_t crc, const uint8_t* data, size_t len) {
+    size_t i = 0;
+#ifdef __x86_64__
+    for (; i + 8 <= len; i += 8) {
+        uint64_t v;
+        memcpy(&v, data + i, 8);
+        crc = _mm_crc32_u64(crc, v);
+    }
+#endif
+    for (; i < len; i++)
+        crc = _mm_crc32_u8(crc, data[i]);
+    return crc;
+}
+#endif
+
+uint32_t led_hash_crc32c(const void* data, size_t len) {
+    const uint8_t* p = data;
+    uint32_t crc = 0xFFFFFFFF;
+#ifdef LED_HASH_X86
+    if (led_hash_crc32c_hw)
+        return ~led_hash_crc32c_sse42(crc, p, len);
+#endif
+    for (size_t i = 0; i < len; i++)
+        crc = led_hash_crc32c_table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+//-----------------------------------------------
+// LED xxHash64
+//-----------------------------------------------
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+#define led_rotl64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+uint64_t led_hash_xxh64_round(uint64_t acc, uint64_t lane) {
+    acc += lane * XXH_PRIME64_2;
+    return led_rotl64(acc, 31) * XXH_PRIME64_1;
+}
+
+uint64_t led_hash_xxh64_merge(uint64_t h, uint64_t v) {
+    h ^= led_hash_xxh64_round(0, v);
+    return h * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t led_hash_xxh64(const void* data, size_t len, uint64_t seed) {
+    const uint8_t* p = data;
+    const uint8_t* end = p + len;
+    uint64_t h, v;
+    uint32_t v32;
+
+    if (len >= 32) {
+        uint64_t acc[4] = { seed + XXH_PRIME64_1 + XXH_PRIME64_2, seed + XXH_PRIME64_2, seed, seed - XXH_PRIME64_1 };
+        for (; p + 32 <= end; p += 32)
+            led_foreach_int(4) {
+                memcpy(&v, p + 8 * foreach.i, 8);
+                acc[foreach.i] = led_hash_xxh64_round(acc[foreach.i], v);
+            }
+        h = led_rotl64(acc[0], 1) + led_rotl64(acc[1], 7) + led_rotl64(acc[2], 12) + led_rotl64(acc[3], 18);
+        led_foreach_int(4)
+            h = led_hash_xxh64_merge(h, acc[foreach.i]);
+    }
+    else
+        h = seed + XXH_PRIME64_5;
+
+    h += len;
+    for (; p + 8 <= end; p += 8) {
+        memcpy(&v, p, 8);
+        h ^= led_hash_xxh64_round(0, v);
+        h = led_rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (p + 4 <= end) {
+        memcpy(&v32, p, 4);
+        h ^= v32 * XXH_PRIME64_1;
+        h = led_rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= *p * XXH_PRIME64_5;
+        h = led_rotl64(h, 11) * XXH_PRIME64_1;
+    }
+
+    // avalanche
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+//-----------------------------------------------
+// LED SHA-256
+//-----------------------------------------------
+
+const uint32_t led_sha256_k[64] = {
+    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
+    0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
+    0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
+    0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7,0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967,
+    0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13,0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85,
+    0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3,0xd192e819,0xd6990624,0xf40e3585,0x106aa070,
+    0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5,0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3,
+    0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2,
+};
+
+#define led_rotr32(x, r) (((x) >> (r)) | ((x) << (32 - (r))))
+
+void led_hash_sha256_block(uint32_t* state, const uint8_t* block) {
+    uint32_t w[64];
+    led_foreach_int(16)
+        w[foreach.i] = (uint32_t)block[4*foreach.i] << 24 | (uint32_t)block[4*foreach.i+1] << 16 | (uint32_t)block[4*foreach.i+2] << 8 | block[4*foreach.i+3];
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = led_rotr32(w[i-15], 7) ^ led_rotr32(w[i-15], 18) ^ (w[i-15] >> 3);
+        uint32_t s1 = led_rotr32(w[i-2], 17) ^ led_rotr32(w[i-2], 19) ^ (w[i-2] >> 10);
+        w[i] = w[i-16] + s0 + w[i-7] + s1;
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (led_rotr32(e, 6) ^ led_rotr32(e, 11) ^ led_rotr32(e, 25)) + ((e & f) ^ (~e & g)) + led_sha256_k[i] + w[i];
+        uint32_t t2 = (led_rotr32(a, 2) ^ led_rotr32(a, 13) ^ led_rotr32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+#ifdef LED_HASH_X86
+// SHA extensions: 4 rounds per sha256rnds2 pair, the message schedule with sha256msg1/msg2
+__attribute__((target("sha,sse4.1")))
+void led_hash_sha256_block_shani(uint32_t* state, const uint8_t* block) {
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // state as ABEF and CDGH
+    __m128i tmp = _mm_loadu_si128((const __m128i*)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i*)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    state1 = _mm_shuffle_epi32(state1, 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+    __m128i abef_save = state0;
+    __m128i cdgh_save = state1;
+
+    __m128i msg[4];
+    led_foreach_int(4)
+        msg[foreach.i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(block + 16 * foreach.i)), bswap);
+
+    for (int i = 0; i < 16; i++) {
+        __m128i m = msg[i & 3];
+        __m128i wk = _mm_add_epi32(m, _mm_loadu_si128((const __m128i*)&led_sha256_k[4 * i]));
+        state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+        // message schedule of the next groups of 4 words
+        if (i >= 3 && i <= 14) {
+            __m128i t = _mm_add_epi32(msg[(i + 1) & 3], _mm_alignr_epi8(m, msg[(i + 3) & 3], 4));
+            msg[(i + 1) & 3] = _mm_sha256msg2_epu32(t, m);
+        }
+        if (i >= 1 && i <= 12)
+            msg[(i + 3) & 3] = _mm_sha256msg1_epu32(msg[(i + 3) & 3], m);
+        wk = _mm_shuffle_epi32(wk, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+    }
+
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+
+    // back to ABCD and EFGH
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i*)&state[0], state0);
+    _mm_storeu_si128((__m128i*)&state[4], state1);
+}
+#endif
+
+void led_hash_sha256(const void* data, size_t len, uint8_t* digest) {
+    uint32_t state[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    void (*block_fn)(uint32_t*, const uint8_t*) = &led_hash_sha256_block;
+#ifdef LED_HASH_X86
+    if (led_hash_sha256_hw) block_fn = &led_hash_sha256_block_shani;
+#endif
+    const uint8_t* p = data;
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64)
+        block_fn(state, p + i);
+
+    // padding with the bits length in the last 8 bytes
+    uint8_t last[128] = {0};
+    size_t rest = len - i;
+    memcpy(last, p + i, rest);
+    last[rest] = 0x80;
+    size_t last_len = rest < 56 ? 64 : 128;
+    uint64_t bits = (uint64_t)len * 8;
+    led_foreach_int(8)
+        last[last_len - 1 - foreach.i] = bits >> (8 * foreach.i);
+    for (size_t j = 0; j < last_len; j += 64)
+        block_fn(state, last + j);
+
+    led_foreach_int(8) {
+        digest[4*foreach.i] = state[foreach.i] >> 24;
+        digest[4*foreach.i+1] = state[foreach.i] >> 16;
+        digest[4*foreach.i+2] = state[foreach.i] >> 8;
+        digest[4*foreach.i+3] = state[foreach.i];
+    }
+}
+
+//-----------------------------------------------
+// LED dedup set
+//-----------------------------------------------
+
+void* led_dedup_map(size_t size) {
+    // reserved only, the pages are given by the system on first touch
+    void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    led_assert(p != MAP_FAILED, LED_ERR_INTERNAL, "Dedup memory not available");
+    return p;
+}
+
+void led_dedup_init(led_dedup_t* set, bool exact, size_t size_max) {
+    if (!set->fp) {
+        set->fp = led_dedup_map(2 * LED_DEDUP_MAX * sizeof(*set->fp));
+        set->size = LED_DEDUP_MIN;
+        set->size_max = LED_DEDUP_MAX;
+    }
+    if (exact && !set->exact) {
+        set->off = led_dedup_map(2 * LED_DEDUP_MAX * sizeof(*set->off));
+        set->arena = led_dedup_map(LED_DEDUP_ARENA_MAX);
+        set->exact = true;
+    }
+    // the smallest max size wins when several functions share the set
+    if (size_max < LED_DEDUP_MIN) size_max = LED_DEDUP_MIN;
+    if (size_max < set->size_max) set->size_max = size_max;
+    led_debug("led_dedup_init: exact=%d size_max=%lu", set->exact, set->size_max);
+}
+
+bool led_dedup_equal(led_dedup_t* set, uint32_t off, const char* key, size_t len) {
+    // keys not stored when the arena is full are compared on fingerprint only
+    if (off == UINT32_MAX) return true;
+    uint32_t klen;
+    memcpy(&klen, set->arena + off, sizeof klen);
+    return klen == len && memcmp(set->arena + off + sizeof klen, key, len) == 0;
+}
+
+void led_dedup_grow(led_dedup_t* set) {
+    size_t size = 2 * set->size;
+    size_t mask = size - 1;
+    uint64_t* table = set->fp + set->size;
+    uint64_t* table_new = set->fp + size;
+
+    for (size_t i = 0; i < set->size; i++) {
+        if (!table[i]) continue;
+        size_t j = table[i] & mask;
+        while (table_new[j]) j = (j + 1) & mask;
+        table_new[j] = table[i];
+        if (set->exact) set->off[size + j] = set->off[set->size + i];
+    }
+    // the previous level pages go back to the system
+    madvise(table, set->size * sizeof(*table), MADV_DONTNEED);
+    if (set->exact) madvise(set->off + set->size, set->size * sizeof(*set->off), MADV_DONTNEED);
+    set->size = size;
+    led_debug("led_dedup_grow: size=%lu count=%lu", set->size, set->count);
+}
+
+bool led_dedup_add(led_dedup_t* set, const char* key, size_t len, uint64_t seed) {
+    uint64_t fp = led_hash_xxh64(key, len, seed);
+    fp += !fp;
+    uint64_t* table = set->fp + set->size;
+    size_t mask = set->size - 1;
+    size_t i = fp & mask;
+    // at max size and load, the probe is bounded and its last slot is replaced: an evicted key passes again
+    bool full = set->size == set->size_max && 2 * set->count >= set->size;
+
+    for (size_t n = 0; table[i]; i = (i + 1) & mask, n++) {
+        if (table[i] == fp && (!set->exact || led_dedup_equal(set, set->off[set->size + i], key, len)))
+            return false;
+        if (full && n == LED_DEDUP_PROBE) break;
+    }
+    if (table[i]) set->evict_count++;
+    else set->count++;
+    table[i] = fp;
+
+    if (set->exact) {
+        uint32_t klen = len;
+        if (set->arena_len + sizeof klen + len <= LED_DEDUP_ARENA_MAX) {
+            set->off[set->size + i] = set->arena_len;
+            memcpy(set->arena + set->arena_len, &klen, sizeof klen);
+            memcpy(set->arena + set->arena_len + sizeof klen, key, len);
+            set->arena_len += sizeof klen + len;
+        }
+        else
+            set->off[set->size + i] = UINT32_MAX;
+    }
+    if (2 * set->count > set->size && set->size < set->size_max)
+        led_dedup_grow(set);
+    return true;
+}
+
+void led_dedup_free(led_dedup_t* set) {
+    if (set->fp) munmap(set->fp, 2 * LED_DEDUP_MAX * sizeof(*set->fp));
+    if (set->off) munmap(set->off, 2 * LED_DEDUP_MAX * sizeof(*set->off));
+    if (set->arena) munmap(set->arena, LED_DEDUP_ARENA_MAX);
+    set->fp = NULL;
+    set->off = NULL;
+    set->arena = NULL;
+    set->arena_len = set->count = set->evict_count = 0;
+    set->exact = false;
+}
+
+size_t led_dedup_memory(led_dedup_t* set) {
+    if (!set->fp) return 0;
+    return set->size * sizeof(*set->fp) + (set->exact ? set->size * sizeof(*set->off) + set->arena_len : 0);
+}
+
+//-----------------------------------------------
+// LED memo cache
+//-----------------------------------------------
+
+void led_memo_init(led_memo_t* memo) {
+    memo->entry = led_dedup_map(LED_MEMO_MAX * sizeof(*memo->entry));
+    memo->bucket = led_dedup_map(2 * LED_MEMO_MAX * sizeof(*memo->bucket));
+    led_debug("led_memo_init: entries=%lu", LED_MEMO_MAX);
+}
+
+void led_memo_free(led_memo_t* memo) {
+    if (memo->entry) munmap(memo->entry, LED_MEMO_MAX * sizeof(*memo->entry));
+    if (memo->bucket) munmap(memo->bucket, 2 * LED_MEMO_MAX * sizeof(*memo->bucket));
+    memo->entry = NULL;
+    memo->bucket = NULL;
+    memo->count = memo->head = memo->tail = 0;
+}
+
+void led_memo_unlink(led_memo_t* memo, uint32_t i) {
+    led_memo_entry_t* entry = &memo->entry[i-1];
+    if (entry->prev) memo->entry[entry->prev-1].next = entry->next;
+    else memo->head = entry->next;
+    if (entry->next) memo->entry[entry->next-1].prev = entry->prev;
+    else memo->tail = entry->prev;
+    entry->prev = entry->next = 0;
+}
+
+void led_memo_link_head(led_memo_t* memo, uint32_t i) {
+    led_memo_entry_t* entry = &memo->entry[i-1];
+    entry->next = memo->head;
+    if (memo->head) memo->entry[memo->head-1].prev = i;
+    else memo->tail = i;
+    memo->head = i;
+}
+
+void led_memo_unchain(led_memo_t* memo, uint32_t i) {
+    uint32_t* pi = &memo->bucket[memo->entry[i-1].hash & (2 * LED_MEMO_MAX - 1)];
+    while (*pi != i) pi = &memo->entry[*pi-1].chain;
+    *pi = memo->entry[i-1].chain;
+    memo->entry[i-1].chain = 0;
+}
+
+led_memo_entry_t* led_memo_get(led_memo_t* memo, const char* key, size_t len) {
+    if (len > LED_MEMO_DATA_MAX - 2) return NULL;
+    uint64_t hash = led_hash_xxh64(key, len, 0);
+    uint32_t* bucket = &memo->bucket[hash & (2 * LED_MEMO_MAX - 1)];
+    for (uint32_t i = *bucket; i; i = memo->entry[i-1].chain) {
+        led_memo_entry_t* entry = &memo->entry[i-1];
+        if (entry->hash == hash && entry->klen == len && entry->valid && !memcmp(entry->data, key, len)) {
+            if (memo->head != i) {
+                led_memo_unlink(memo, i);
+                led_memo_link_head(memo, i);
+            }
+            memo->hit_count++;
+            return entry;
+        }
+    }
+    memo->miss_count++;
+
+    // a new slot while the cache is not full, else the least recently used one
+    uint32_t i;
+    if (memo->count < LED_MEMO_MAX)
+        i = ++memo->count;
+    else {
+        i = memo->tail;
+        led_memo_unchain(memo, i);
+        led_memo_unlink(memo, i);
+    }
+    led_memo_entry_t* entry = &memo->entry[i-1];
+    entry->hash = hash;
+    entry->klen = len;
+    entry->vlen = 0;
+    entry->valid = false;
+    memcpy(entry->data, key, len);
+    entry->chain = *bucket;
+    *bucket = i;
+    led_memo_link_head(memo, i);
+    return entry;
+}
+
+void led_memo_set(led_memo_t* memo, led_memo_entry_t* entry, const char* val, size_t len, bool deleted) {
+    uint32_t i = entry - memo->entry + 1;
+    if (entry->klen + len + 1 > LED_MEMO_DATA_MAX) {
+        // the result does not fit, the slot stays invalid and is the first one to reuse
+        led_memo_unlink(memo, i);
+        entry->next = 0;
+        entry->prev = memo->tail;
+        if (memo->tail) memo->entry[memo->tail-1].next = i;
+        else memo->head = i;
+        memo->tail = i;
+        return;
+    }
+    // the result is kept terminated to be a line view
+    if (len) memcpy(entry->data + entry->klen, val, len);
+    entry->data[entry->klen + len] = '\0';
+    entry->vlen = len;
+    entry->deleted = deleted;
+    entry->valid = true;
+}
@@ -0,0 +1,74 @@
+/***************************************************************************
+ Copyright (C) 2024 - Olivier ROUITS <olivier.rouits@free.fr>
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ USA
+ ***************************************************************************/
+
+#include "led.h"
+#include <sys/mman.h>
+
+//-----------------------------------------------
+// LED rope: pack mode blocks above the line size
+//-----------------------------------------------
+
+void led_rope_app(led_rope_t* rope, const char* str, size_t len) {
+    if (!rope->mem) {
+        rope->mem = mmap(NULL, LED_ROPE_MEM_MAX, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        led_assert(rope->mem != MAP_FAILED, LED_ERR_INTERNAL, "Rope memory not available");
+    }
+    // the memory is filled first, then the spill file keeps the tail
+    size_t n = len < LED_ROPE_MEM_MAX - rope->mem_len ? len : LED_ROPE_MEM_MAX - rope->mem_len;
+    memcpy(rope->mem + rope->mem_len, str, n);
+    rope->mem_len += n;
+    if (n < len) {
+        if (!rope->spill) {
+            rope->spill = tmpfile();
+            led_assert(rope->spill != NULL, LED_ERR_FILE, "Rope temporary file error");
+            led_debug("led_rope_app: spill at len=%lu", rope->mem_len);
+        }
+        led_assert(fwrite(str + n, 1, len - n, rope->spill) == len - n, LED_ERR_FILE, "Rope temporary file write error");
+        rope->spill_len += len - n;
+    }
+}
+
+const char* led_rope_chunk(led_rope_t* rope, size_t offset, size_t* len, char* buf) {
+    // chunks in memory are views, the spilled ones are read in the buffer of LED_ROPE_CHUNK bytes
+    if (offset < rope->mem_len) {
+        *len = rope->mem_len - offset < LED_ROPE_CHUNK ? rope->mem_len - offset : LED_ROPE_CHUNK;
+        return rope->mem + offset;
+    }
+    if (offset == rope->mem_len && rope->spill) {
+        led_assert(fflush(rope->spill) == 0 && !ferror(rope->spill), LED_ERR_FILE, "Rope temporary file write error");
+        rewind(rope->spill);
+    }
+    *len = offset - rope->mem_len < rope->spill_len ? fread(buf, 1, LED_ROPE_CHUNK, rope->spill) : 0;
+    return buf;
+}
+
+void led_rope_reset(led_rope_t* rope) {
+    if (rope->spill) fclose(rope->spill);
+    rope->spill = NULL;
+    rope->spill_len = 0;
+    // the memory goes back to the system until the next block
+    if (rope->mem_len) madvise(rope->mem, rope->mem_len, MADV_DONTNEED);
+    rope->mem_len = 0;
+}
+
+void led_rope_free(led_rope_t* rope) {
+    led_rope_reset(rope);
+    if (rope->mem) munmap(rope->mem, LED_ROPE_MEM_MAX);
+    rope->mem = NULL;
+}
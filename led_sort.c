@@ -0,0 +1,280 @@
+/***************************************************************************
+ Copyright (C) 2024 - Olivier ROUITS <olivier.rouits@free.fr>
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ USA
+ ***************************************************************************/
+
+#include "led.h"
+#include <sys/mman.h>
+
+//-----------------------------------------------
+// LED sort records compare
+//-----------------------------------------------
+
+uint64_t led_sort_prefix(led_sort_t* sort, const char* key, size_t klen) {
+    uint64_t prefix = 0;
+    if (sort->numeric) {
+        char buf[64];
+        size_t n = klen < sizeof buf - 1 ? klen : sizeof buf - 1;
+        memcpy(buf, key, n);
+        buf[n] = '\0';
+        double val = strtod(buf, NULL);
+        memcpy(&prefix, &val, sizeof prefix);
+        // IEEE bits in unsigned order: negative values reversed, positive ones above
+        prefix = prefix >> 63 ? ~prefix : prefix | 1ULL << 63;
+    }
+    else
+        for (size_t i = 0; i < 8; i++)
+            prefix = prefix << 8 | (i < klen ? (uint8_t)key[i] : 0);
+    return sort->reverse ? ~prefix : prefix;
+}
+
+int led_sort_cmp(led_sort_t* sort, const led_sort_rec_t* a, const char* la, const led_sort_rec_t* b, const char* lb) {
+    if (a->prefix != b->prefix) return a->prefix < b->prefix ? -1 : 1;
+    if (sort->numeric) return 0;
+    // same prefix, the key rest then the key length decide
+    size_t n = a->klen < b->klen ? a->klen : b->klen;
+    int rc = n > 8 ? memcmp(la + a->kstart + 8, lb + b->kstart + 8, n - 8) : 0;
+    if (!rc) rc = (a->klen > b->klen) - (a->klen < b->klen);
+    return sort->reverse ? -rc : rc;
+}
+
+//-----------------------------------------------
+// LED sort in memory: stable LSD radix on the prefixes, merge sort on the prefix ties
+//-----------------------------------------------
+
+void led_sort_merge_recs(led_sort_t* sort, led_sort_rec_t* rec, led_sort_rec_t* tmp, size_t n) {
+    if (n < 16) {
+        for (size_t i = 1; i < n; i++) {
+            led_sort_rec_t r = rec[i];
+            size_t j = i;
+            for (; j > 0 && led_sort_cmp(sort, &rec[j-1], sort->mem + rec[j-1].off, &r, sort->mem + r.off) > 0; j--)
+                rec[j] = rec[j-1];
+            rec[j] = r;
+        }
+        return;
+    }
+    size_t h = n / 2;
+    led_sort_merge_recs(sort, rec, tmp, h);
+    led_sort_merge_recs(sort, rec + h, tmp + h, n - h);
+    size_t i = 0, j = h, k = 0;
+    while (i < h && j < n)
+        tmp[k++] = led_sort_cmp(sort, &rec[j], sort->mem + rec[j].off, &rec[i], sort->mem + rec[i].off) < 0 ? rec[j++] : rec[i++];
+    while (i < h) tmp[k++] = rec[i++];
+    while (j < n) tmp[k++] = rec[j++];
+    memcpy(rec, tmp, n * sizeof(*rec));
+}
+
+void led_sort_recs(led_sort_t* sort) {
+    size_t n = sort->count;
+    led_sort_rec_t* rec = (led_sort_rec_t*)sort->mem;
+    led_sort_rec_t* src = rec;
+    led_sort_rec_t* dst = rec + n;
+    size_t count[8][0x100] = {{0}};
+
+    if (n < 2) return;
+    for (size_t i = 0; i < n; i++)
+        for (int b = 0; b < 8; b++)
+            count[b][(src[i].prefix >> (8 * b)) & 0xFF]++;
+    for (int b = 0; b < 8; b++) {
+        // bytes equal in all prefixes need no pass
+        if (count[b][(src[0].prefix >> (8 * b)) & 0xFF] == n) continue;
+        size_t pos[0x100];
+        size_t sum = 0;
+        for (int v = 0; v < 0x100; v++) {
+            pos[v] = sum;
+            sum += count[b][v];
+        }
+        for (size_t i = 0; i < n; i++)
+            dst[pos[(src[i].prefix >> (8 * b)) & 0xFF]++] = src[i];
+        led_sort_rec_t* t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != rec) memcpy(rec, src, n * sizeof(*rec));
+
+    if (sort->numeric) return;
+    for (size_t i = 0, j; i < n; i = j) {
+        bool longkey = rec[i].klen > 8;
+        for (j = i + 1; j < n && rec[j].prefix == rec[i].prefix; j++)
+            longkey = longkey || rec[j].klen > 8;
+        if (j - i > 1 && longkey)
+            led_sort_merge_recs(sort, rec + i, rec + n, j - i);
+    }
+}
+
+//-----------------------------------------------
+// LED sort runs
+//-----------------------------------------------
+
+void led_sort_write_rec(FILE* file, const led_sort_rec_t* rec, const char* line) {
+    fwrite(rec, sizeof(*rec), 1, file);
+    fwrite(line, 1, rec->len, file);
+}
+
+bool led_sort_read_rec(FILE* file, led_sort_rec_t* rec, char* line) {
+    return fread(rec, sizeof(*rec), 1, file) == 1 && fread(line, 1, rec->len, file) == rec->len;
+}
+
+void led_sort_write_line(FILE* file, const char* line, size_t len) {
+    fwrite(line, 1, len, file);
+    fputc('\n', file);
+}
+
+bool led_sort_heap_less(led_sort_t* sort, led_sort_rec_t* head, size_t i, size_t j) {
+    // equal keys keep the runs order
+    int rc = led_sort_cmp(sort, &head[i], sort->mem + i * (LED_BUF_MAX + 1), &head[j], sort->mem + j * (LED_BUF_MAX + 1));
+    return rc < 0 || (rc == 0 && i < j);
+}
+
+size_t led_sort_merge(led_sort_t* sort, size_t first, FILE* file, bool spill) {
+    // the memory is empty here, it gives the heads of the runs from the first one
+    led_sort_rec_t head[LED_SORT_RUN_MAX];
+    size_t heap[LED_SORT_RUN_MAX];
+    size_t heap_len = 0;
+    size_t written = 0;
+    FILE** run = sort->run + first;
+
+    for (size_t k = 0; k < sort->run_count - first; k++)
+        if (led_sort_read_rec(run[k], &head[k], sort->mem + k * (LED_BUF_MAX + 1)))
+            heap[heap_len++] = k;
+    // binary heap of the run heads
+    for (size_t s = heap_len / 2; s-- > 0;)
+        for (size_t i = s, c; (c = 2 * i + 1) < heap_len; i = c) {
+            if (c + 1 < heap_len && led_sort_heap_less(sort, head, heap[c+1], heap[c])) c++;
+            if (!led_sort_heap_less(sort, head, heap[c], heap[i])) break;
+            size_t t = heap[i]; heap[i] = heap[c]; heap[c] = t;
+        }
+    while (heap_len) {
+        size_t k = heap[0];
+        char* line = sort->mem + k * (LED_BUF_MAX + 1);
+        if (spill) led_sort_write_rec(file, &head[k], line);
+        else led_sort_write_line(file, line, head[k].len);
+        written++;
+        if (!led_sort_read_rec(run[k], &head[k], line))
+            heap[0] = heap[--heap_len];
+        for (size_t i = 0, c; (c = 2 * i + 1) < heap_len; i = c) {
+            if (c + 1 < heap_len && led_sort_heap_less(sort, head, heap[c+1], heap[c])) c++;
+            if (!led_sort_heap_less(sort, head, heap[c], heap[i])) break;
+            size_t t = heap[i]; heap[i] = heap[c]; heap[c] = t;
+        }
+    }
+    for (size_t k = 0; k < sort->run_count - first; k++)
+        fclose(run[k]);
+    sort->run_count = first;
+    return written;
+}
+
+void led_sort_merge_run(led_sort_t* sort, size_t first, size_t level) {
+    FILE* file = tmpfile();
+    led_assert(file != NULL, LED_ERR_FILE, "Sort temporary file error");
+    led_sort_merge(sort, first, file, true);
+    led_assert(fflush(file) == 0 && !ferror(file), LED_ERR_FILE, "Sort temporary file write error");
+    rewind(file);
+    sort->run_level[sort->run_count] = level;
+    sort->run[sort->run_count++] = file;
+    led_debug("led_sort_merge_run: run=%lu level=%lu", sort->run_count, level);
+}
+
+void led_sort_spill(led_sort_t* sort) {
+    led_sort_recs(sort);
+    FILE* file = tmpfile();
+    led_assert(file != NULL, LED_ERR_FILE, "Sort temporary file error");
+    led_sort_rec_t* rec = (led_sort_rec_t*)sort->mem;
+    for (size_t i = 0; i < sort->count; i++)
+        led_sort_write_rec(file, &rec[i], sort->mem + rec[i].off);
+    led_assert(fflush(file) == 0 && !ferror(file), LED_ERR_FILE, "Sort temporary file write error");
+    rewind(file);
+    sort->run_level[sort->run_count] = 0;
+    sort->run[sort->run_count++] = file;
+    sort->count = sort->data_len = 0;
+    sort->spill_count++;
+    led_debug("led_sort_spill: run=%lu", sort->run_count);
+
+    // the last runs of a full level are merged in one of the next level, a line is rewritten once per level
+    while (sort->run_count >= LED_SORT_RUN_MAX
+        && sort->run_level[sort->run_count - LED_SORT_RUN_MAX] == sort->run_level[sort->run_count - 1]) {
+        size_t level = sort->run_level[sort->run_count - 1] + 1;
+        led_assert(level < LED_SORT_LEVEL_MAX, LED_ERR_INTERNAL, "Sort runs exceed maximum level %d", LED_SORT_LEVEL_MAX);
+        led_sort_merge_run(sort, sort->run_count - LED_SORT_RUN_MAX, level);
+    }
+}
+
+//-----------------------------------------------
+// LED sort stage
+//-----------------------------------------------
+
+void led_sort_init(led_sort_t* sort, size_t mem_size, bool numeric, bool reverse) {
+    // offsets in the memory are 32 bits
+    if (mem_size < LED_SORT_MEM_MIN) mem_size = LED_SORT_MEM_MIN;
+    if (mem_size > UINT32_MAX) mem_size = UINT32_MAX;
+    sort->mem = mmap(NULL, mem_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    led_assert(sort->mem != MAP_FAILED, LED_ERR_INTERNAL, "Sort memory not available");
+    sort->mem_size = mem_size;
+    sort->numeric = numeric;
+    sort->reverse = reverse;
+    led_debug("led_sort_init: mem=%lu numeric=%d reverse=%d", mem_size, numeric, reverse);
+}
+
+void led_sort_add(led_sort_t* sort, const char* line, size_t len, size_t kstart, size_t kstop) {
+    // room for the record, its radix copy and the line
+    if (2 * (sort->count + 1) * sizeof(led_sort_rec_t) + sort->data_len + len > sort->mem_size)
+        led_sort_spill(sort);
+    sort->data_len += len;
+    led_sort_rec_t* rec = (led_sort_rec_t*)sort->mem + sort->count++;
+    rec->off = sort->mem_size - sort->data_len;
+    rec->len = len;
+    rec->kstart = kstart;
+    rec->klen = kstop - kstart;
+    memcpy(sort->mem + rec->off, line, len);
+    rec->prefix = led_sort_prefix(sort, line + kstart, rec->klen);
+}
+
+size_t led_sort_flush(led_sort_t* sort, FILE* file) {
+    size_t written = 0;
+    if (!sort->mem || (!sort->count && !sort->run_count)) return 0;
+
+    if (sort->run_count) {
+        if (sort->count) led_sort_spill(sort);
+        // all the levels are merged at the end, the last and smallest runs first above the merge max
+        while (sort->run_count > LED_SORT_RUN_MAX)
+            led_sort_merge_run(sort, sort->run_count - LED_SORT_RUN_MAX, sort->run_level[sort->run_count - 1] + 1);
+        written = led_sort_merge(sort, 0, file, false);
+    }
+    else {
+        led_sort_recs(sort);
+        led_sort_rec_t* rec = (led_sort_rec_t*)sort->mem;
+        for (size_t i = 0; i < sort->count; i++)
+            led_sort_write_line(file, sort->mem + rec[i].off, rec[i].len);
+        written = sort->count;
+    }
+    fflush(file);
+    sort->count = sort->data_len = 0;
+    // the memory goes back to the system until the next file
+    madvise(sort->mem, sort->mem_size, MADV_DONTNEED);
+    led_debug("led_sort_flush: written=%lu spill=%lu", written, sort->spill_count);
+    return written;
+}
+
+void led_sort_free(led_sort_t* sort) {
+    // the runs are left open when exiting on error
+    for (size_t i = 0; i < sort->run_count; i++)
+        fclose(sort->run[i]);
+    sort->run_count = 0;
+    if (sort->mem) munmap(sort->mem, sort->mem_size);
+    sort->mem = NULL;
+    sort->count = sort->data_len = 0;
+}
@@ -19,6 +19,15 @@
 
 #include "led.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <tmmintrin.h>
+#define LED_STR_X86
+#endif
+
 //-----------------------------------------------
 // LED str functions
 //-----------------------------------------------
@@ -44,7 +53,7 @@ pcre2_code* led_regex_compile(const char* pattern, size_t opt) {
     pcre2_code* regex = pcre2_compile(
         (PCRE2_SPTR)pattern,
         PCRE2_ZERO_TERMINATED,
-        PCRE2_UTF|opt,
+        PCRE2_UTF|PCRE2_MATCH_INVALID_UTF|opt,
         &pcre_err,
         &pcre_erroff,
         NULL);
@@ -75,6 +84,46 @@ bool led_str_match_offset(led_str_t* lstr, pcre2_code* regex, size_t* pzone_star
     return rc > 0;
 }
 
+void led_str_match_iter_init(led_str_match_iter_t* iter, pcre2_code* regex) {
+    iter->regex = regex;
+    iter->match_data = pcre2_match_data_create_from_pattern(regex, NULL);
+    iter->ovector = pcre2_get_ovector_pointer(iter->match_data);
+    led_str_match_iter_reset(iter);
+}
+
+void led_str_match_iter_free(led_str_match_iter_t* iter) {
+    if (iter->match_data != NULL) {
+        pcre2_match_data_free(iter->match_data);
+        iter->match_data = NULL;
+        iter->ovector = NULL;
+    }
+}
+
+bool led_str_match_iter_next(led_str_match_iter_t* iter, led_str_t* lstr) {
+    while (iter->offset <= lstr->len) {
+        int rc = pcre2_match(iter->regex, (PCRE2_SPTR)lstr->str, lstr->len, iter->offset, iter->opts, iter->match_data, NULL);
+        if (rc == PCRE2_ERROR_NOMATCH && iter->opts) {
+            // no non-empty match at the position of the previous empty match, move forward one char
+            iter->opts = 0;
+            iter->offset = led_uchar_pos_next(lstr->str, iter->offset);
+            continue;
+        }
+        if (rc <= 0) break;
+
+        // the zone is the last capture group, like led_str_match_offset
+        int iv = (rc - 1) * 2;
+        iter->zone_start = iter->ovector[iv];
+        iter->zone_stop = iter->ovector[iv + 1];
+        iter->offset = iter->ovector[1];
+        // after an empty match look for a non-empty one at the same position first
+        iter->opts = iter->ovector[0] == iter->ovector[1] ? PCRE2_NOTEMPTY_ATSTART | PCRE2_ANCHORED : 0;
+        led_debug("led_str_match_iter_next: zone start=%lu stop=%lu", iter->zone_start, iter->zone_stop);
+        return true;
+    }
+    iter->offset = lstr->len + 1;
+    return false;
+}
+
 led_str_t* led_str_cut_next(led_str_t* lstr, led_uchar_t uc, led_str_t* stok) {
     led_str_clone(stok, lstr);
     led_str_foreach_uchar(lstr) {
@@ -96,12 +145,771 @@ led_str_t* led_str_cut_next(led_str_t* lstr, led_uchar_t uc, led_str_t* stok) {
     return lstr;
 }
 
+size_t led_str_ascii_span(const char* str, size_t len) {
+    size_t i = 0;
+#ifdef __SSE2__
+    // 16 bytes at once, the high bits of the bytes give the non ASCII ones
+    for (; i + 16 <= len; i += 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(str + i)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+#endif
+    for (; i < len; i++)
+        if (str[i] & 0x80) break;
+    return i;
+}
+
+bool led_str_isutf8(const char* str, size_t len) {
+    size_t i = 0;
+    for (;;) {
+        i += led_str_ascii_span(str + i, len - i);
+        if (i >= len) return true;
+        led_uchar_t uc;
+        size_t usize = led_uchar_from_str(str + i, &uc);
+        if (usize == 1 || i + usize > len || !led_uchar_isvalid(uc)) return false;
+        i += usize;
+    }
+}
+
+// chars are counted by their first byte, valid UTF-8 only
+#define led_uchar_islead(c) (((c) & 0xC0) != 0x80)
+
+size_t led_str_uchar_count(const char* str, size_t len) {
+    size_t i = 0, count = 0;
+#ifdef __SSE2__
+    // continuation bytes are the signed bytes lower than (char)0xC0
+    __m128i vcont = _mm_set1_epi8((char)0xBF);
+    for (; i + 16 <= len; i += 16)
+        count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(str + i)), vcont)));
+#endif
+    for (; i < len; i++)
+        count += led_uchar_islead(str[i]);
+    return count;
+}
+
+size_t led_str_pos_uchar_n(const char* str, size_t len, size_t n) {
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128i vcont = _mm_set1_epi8((char)0xBF);
+    for (; i + 16 <= len; i += 16) {
+        size_t count = __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(str + i)), vcont)));
+        if (count > n) break;
+        n -= count;
+    }
+#endif
+    for (; i < len; i++)
+        if (led_uchar_islead(str[i]) && n-- == 0) break;
+    return i;
+}
+
+size_t led_str_find_csv(const char* str, size_t len, char sep, bool* quoted) {
+    size_t i = 0;
+    bool q = *quoted;
+#ifdef __SSE2__
+    __m128i vquote = _mm_set1_epi8('"');
+    __m128i vsep = _mm_set1_epi8(sep);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(str + i));
+        uint32_t mquote = _mm_movemask_epi8(_mm_cmpeq_epi8(v, vquote));
+        uint32_t msep = _mm_movemask_epi8(_mm_cmpeq_epi8(v, vsep));
+        // prefix xor of the quotes gives the bytes inside quotes, escaped quotes switch twice
+        uint32_t minq = mquote;
+        minq ^= minq << 1;
+        minq ^= minq << 2;
+        minq ^= minq << 4;
+        minq ^= minq << 8;
+        if (q) minq = ~minq;
+        msep &= ~minq & 0xFFFF;
+        if (msep) {
+            *quoted = false;
+            return i + __builtin_ctz(msep);
+        }
+        q = (minq >> 15) & 1;
+    }
+#endif
+    for (; i < len; i++) {
+        if (str[i] == '"') q = !q;
+        else if (str[i] == sep && !q) break;
+    }
+    *quoted = q;
+    return i;
+}
+
+led_str_t* led_str_app_case_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop, bool upper) {
+    // the range of the chars to convert, then bit 0x20 is switched
+    char cmin = upper ? 'a' : 'A';
+    char cmax = upper ? 'z' : 'Z';
+#ifdef __SSE2__
+    // bytes are signed, non ASCII ones are negative and never in the range
+    __m128i vmin = _mm_set1_epi8(cmin - 1);
+    __m128i vmax = _mm_set1_epi8(cmax + 1);
+    __m128i vcase = _mm_set1_epi8(0x20);
+#endif
+    size_t i = start;
+    while (i < stop) {
+        size_t n = led_str_ascii_span(lstr_src->str + i, stop - i);
+        if (lstr->len + n >= lstr->size)
+            n = lstr->size > lstr->len ? lstr->size - lstr->len - 1 : 0;
+        const char* src = lstr_src->str + i;
+        char* dst = lstr->str + lstr->len;
+        size_t j = 0;
+#ifdef __SSE2__
+        for (; j + 16 <= n; j += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + j));
+            __m128i inrange = _mm_and_si128(_mm_cmpgt_epi8(v, vmin), _mm_cmplt_epi8(v, vmax));
+            _mm_storeu_si128((__m128i*)(dst + j), _mm_xor_si128(v, _mm_and_si128(inrange, vcase)));
+        }
+#endif
+        for (; j < n; j++)
+            dst[j] = src[j] >= cmin && src[j] <= cmax ? src[j] ^ 0x20 : src[j];
+        lstr->len += n;
+        i += n;
+        if (i >= stop || lstr->len + 1 >= lstr->size) break;
+        // multi-bytes char
+        led_uchar_t uc = led_str_uchar_next(lstr_src, i, &i);
+        led_str_app_uchar(lstr, upper ? led_uchar_toupper(uc) : led_uchar_tolower(uc));
+    }
+    lstr->str[lstr->len] = '\0';
+    return lstr;
+}
+
+led_str_t* led_str_app_lower_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    return led_str_app_case_zn(lstr, lstr_src, start, stop, false);
+}
+
+led_str_t* led_str_app_upper_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    return led_str_app_case_zn(lstr, lstr_src, start, stop, true);
+}
+
+led_str_t* led_str_app_map_zn(led_str_t* lstr, led_str_t* lstr_src, led_uchar_map_t* map, size_t start, size_t stop) {
+    size_t i = start;
+    while (i < stop) {
+        if (map->ascii_only) {
+            // ASCII run mapped byte per byte
+            size_t n = led_str_ascii_span(lstr_src->str + i, stop - i);
+            if (lstr->len + n >= lstr->size)
+                n = lstr->size > lstr->len ? lstr->size - lstr->len - 1 : 0;
+            for (size_t j = 0; j < n; j++)
+                lstr->str[lstr->len + j] = (char)map->ascii[(uint8_t)lstr_src->str[i + j]];
+            lstr->len += n;
+            i += n;
+            if (i >= stop || lstr->len + 1 >= lstr->size) break;
+        }
+        led_str_app_uchar(lstr, led_uchar_map_get(map, led_str_uchar_next(lstr_src, i, &i)));
+    }
+    lstr->str[lstr->len] = '\0';
+    return lstr;
+}
+
+void led_uchar_set_init(led_uchar_set_t* set, const char* str) {
+    memset(set, 0, sizeof(*set));
+    led_foreach_uchar(str) {
+        if (led_uchar_set_has(set, foreach.uc)) continue;
+        if (foreach.uc < 0x80) {
+            set->ascii[foreach.uc] = true;
+            // over the max the set is not scanned by blocks
+            if (set->scan_count < LED_UCHAR_SET_SCAN_MAX)
+                set->scan[set->scan_count] = (char)foreach.uc;
+            set->scan_count++;
+        }
+        else {
+            led_assert(set->mb_count < LED_UCHAR_SET_MB_MAX, LED_ERR_ARG, "Too many multi-bytes chars in set, max %d", LED_UCHAR_SET_MB_MAX);
+            set->mb[set->mb_count++] = foreach.uc;
+        }
+    }
+}
+
+size_t led_str_find_set(const char* str, size_t len, led_uchar_set_t* set) {
+    size_t i = 0;
+#ifdef __SSE2__
+    if (set->scan_count <= LED_UCHAR_SET_SCAN_MAX) {
+        __m128i vscan[LED_UCHAR_SET_SCAN_MAX];
+        led_foreach_int(set->scan_count)
+            vscan[foreach.i] = _mm_set1_epi8(set->scan[foreach.i]);
+        // blocks without any set char are skipped, non ASCII bytes are candidates when the set has multi-bytes chars
+        while (i + 16 <= len) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(str + i));
+            int mask = set->mb_count ? _mm_movemask_epi8(v) : 0;
+            led_foreach_int(set->scan_count)
+                mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(v, vscan[foreach.i]));
+            if (!mask) {
+                i += 16;
+                continue;
+            }
+            i += __builtin_ctz(mask);
+            if (!(str[i] & 0x80)) return i;
+            // candidate multi-bytes char
+            led_uchar_t uc;
+            size_t usize = led_uchar_from_str(str + i, &uc);
+            if (led_uchar_set_has(set, uc)) return i;
+            i += usize;
+        }
+    }
+#endif
+    while (i < len) {
+        led_uchar_t uc;
+        size_t usize = led_uchar_from_str(str + i, &uc);
+        if (led_uchar_set_has(set, uc)) return i;
+        i += usize;
+    }
+    return len;
+}
+
+size_t led_str_span_set(const char* str, size_t len, led_uchar_set_t* set) {
+    size_t i = 0;
+    while (i < len) {
+        led_uchar_t uc;
+        size_t usize = led_uchar_from_str(str + i, &uc);
+        if (!led_uchar_set_has(set, uc)) break;
+        i += usize;
+    }
+    return i;
+}
+
+//-----------------------------------------------
+// LED byte class
+//-----------------------------------------------
+
+#define LED_BYTE_CLASS_ALNUM ['0' ... '9'] = true, ['A' ... 'Z'] = true, ['a' ... 'z'] = true
+
+// RFC 3986 unreserved chars
+const led_byte_class_t led_byte_class_url = {
+    .byte = { LED_BYTE_CLASS_ALNUM, ['-'] = true, ['.'] = true, ['_'] = true, ['~'] = true },
+    .extra = "-._~",
+    .extra_count = 4
+};
+
+// file name chars without shell meaning
+const led_byte_class_t led_byte_class_shell = {
+    .byte = { LED_BYTE_CLASS_ALNUM, ['/'] = true, ['.'] = true, ['_'] = true, ['-'] = true, ['~'] = true, [':'] = true, ['='] = true, ['%'] = true },
+    .extra = "/._-~:=%",
+    .extra_count = 8
+};
+
+size_t led_str_span_class(const char* str, size_t len, const led_byte_class_t* bclass) {
+    size_t i = 0;
+#ifdef __SSE2__
+    // alnum by signed ranges (non ASCII bytes are negative), letters folded to lower case
+    __m128i vdmin = _mm_set1_epi8('0' - 1);
+    __m128i vdmax = _mm_set1_epi8('9' + 1);
+    __m128i vamin = _mm_set1_epi8('a' - 1);
+    __m128i vamax = _mm_set1_epi8('z' + 1);
+    __m128i vcase = _mm_set1_epi8(0x20);
+    __m128i vextra[LED_BYTE_CLASS_EXTRA_MAX];
+    led_foreach_int(bclass->extra_count)
+        vextra[foreach.i] = _mm_set1_epi8(bclass->extra[foreach.i]);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(str + i));
+        __m128i vl = _mm_or_si128(v, vcase);
+        __m128i vin = _mm_or_si128(_mm_and_si128(_mm_cmpgt_epi8(v, vdmin), _mm_cmplt_epi8(v, vdmax)),
+            _mm_and_si128(_mm_cmpgt_epi8(vl, vamin), _mm_cmplt_epi8(vl, vamax)));
+        led_foreach_int(bclass->extra_count)
+            vin = _mm_or_si128(vin, _mm_cmpeq_epi8(v, vextra[foreach.i]));
+        int mask = _mm_movemask_epi8(vin) ^ 0xFFFF;
+        if (mask) return i + __builtin_ctz(mask);
+    }
+#endif
+    for (; i < len; i++)
+        if (!bclass->byte[(uint8_t)str[i]]) break;
+    return i;
+}
+
+//-----------------------------------------------
+// LED json scanner: on demand, values not in the key path are skipped
+//-----------------------------------------------
+
+size_t led_json_ws(const char* str, size_t len, size_t i) {
+    while (i < len && (str[i] == ' ' || str[i] == '\t' || str[i] == '\n' || str[i] == '\r')) i++;
+    return i;
+}
+
+size_t led_json_skip_str(const char* str, size_t len, size_t i) {
+    // from the opening quote to the position after the closing quote
+    i++;
+#ifdef __SSE2__
+    __m128i vquote = _mm_set1_epi8('"');
+    __m128i vesc = _mm_set1_epi8('\\');
+#endif
+    for (;;) {
+#ifdef __SSE2__
+        for (; i + 16 <= len; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(str + i));
+            int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, vquote), _mm_cmpeq_epi8(v, vesc)));
+            if (mask) {
+                i += __builtin_ctz(mask);
+                break;
+            }
+        }
+#endif
+        while (i < len && str[i] != '"' && str[i] != '\\') i++;
+        if (i >= len) return len;
+        if (str[i] == '"') return i + 1;
+        i += 2;
+    }
+}
+
+size_t led_json_find_struct(const char* str, size_t len) {
+    size_t i = 0;
+#ifdef __SSE2__
+    // with the 0x20 bit set '[' and ']' become '{' and '}'
+    __m128i vquote = _mm_set1_epi8('"');
+    __m128i vopen = _mm_set1_epi8('{');
+    __m128i vclose = _mm_set1_epi8('}');
+    __m128i vcase = _mm_set1_epi8(0x20);
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(str + i));
+        __m128i vc = _mm_or_si128(v, vcase);
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, vquote),
+            _mm_or_si128(_mm_cmpeq_epi8(vc, vopen), _mm_cmpeq_epi8(vc, vclose))));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+#endif
+    for (; i < len; i++)
+        if (str[i] == '"' || (str[i] | 0x20) == '{' || (str[i] | 0x20) == '}') break;
+    return i;
+}
+
+size_t led_json_skip_value(const char* str, size_t len, size_t i) {
+    if (i >= len) return len;
+    if (str[i] == '"') return led_json_skip_str(str, len, i);
+    if (str[i] == '{' || str[i] == '[') {
+        // only the structural chars are looked at, strings are skipped
+        size_t depth = 0;
+        while ((i += led_json_find_struct(str + i, len - i)) < len) {
+            if (str[i] == '"') {
+                i = led_json_skip_str(str, len, i);
+                continue;
+            }
+            if (str[i] == '{' || str[i] == '[') depth++;
+            else if (--depth == 0) return i + 1;
+            i++;
+        }
+        return len;
+    }
+    // number, true, false, null
+    while (i < len && str[i] != ',' && str[i] != '}' && str[i] != ']' && !led_uchar_isspace((uint8_t)str[i])) i++;
+    return i;
+}
+
+bool led_json_find(const char* str, size_t len, const char* path, size_t* pstart, size_t* pstop) {
+    size_t i = led_json_ws(str, len, 0);
+    const char* key = path;
+
+    while (*key) {
+        const char* kend = strchr(key, '.');
+        if (kend == NULL) kend = key + strlen(key);
+        size_t klen = kend - key;
+        if (i >= len) return false;
+
+        if (str[i] == '{') {
+            // members are skipped until the key
+            i = led_json_ws(str, len, i + 1);
+            for (;;) {
+                if (i >= len || str[i] != '"') return false;
+                size_t kstart = i + 1;
+                i = led_json_skip_str(str, len, i);
+                size_t kstop = i - 1;
+                i = led_json_ws(str, len, i);
+                if (i >= len || str[i] != ':') return false;
+                i = led_json_ws(str, len, i + 1);
+                if (kstop >= kstart && kstop - kstart == klen && memcmp(str + kstart, key, klen) == 0) break;
+                i = led_json_ws(str, len, led_json_skip_value(str, len, i));
+                if (i >= len || str[i] != ',') return false;
+                i = led_json_ws(str, len, i + 1);
+            }
+        }
+        else if (str[i] == '[' && led_uchar_isdigit((uint8_t)*key)) {
+            // values are skipped until the index
+            i = led_json_ws(str, len, i + 1);
+            for (size_t n = strtoul(key, NULL, 10); n > 0; n--) {
+                i = led_json_ws(str, len, led_json_skip_value(str, len, i));
+                if (i >= len || str[i] != ',') return false;
+                i = led_json_ws(str, len, i + 1);
+            }
+            if (i >= len || str[i] == ']') return false;
+        }
+        else return false;
+
+        key = *kend ? kend + 1 : kend;
+    }
+    *pstart = i;
+    *pstop = led_json_skip_value(str, len, i);
+    return i < len;
+}
+
+led_str_t* led_str_app_json_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    const char* str = lstr_src->str;
+    if (stop - start < 2 || str[start] != '"' || str[stop - 1] != '"')
+        return led_str_app_zn(lstr, lstr_src, start, stop);
+
+    // JSON string value, unescaped, the runs without escape are copied at once
+    size_t i = start + 1;
+    stop--;
+    while (i < stop) {
+        const char* pesc = memchr(str + i, '\\', stop - i);
+        size_t iesc = pesc ? (size_t)(pesc - str) : stop;
+        led_str_app_zn(lstr, lstr_src, i, iesc);
+        if (iesc + 1 >= stop) break;
+        i = iesc + 1;
+        char c = str[i++];
+        if (c == 'n') led_str_app_uchar(lstr, '\n');
+        else if (c == 't') led_str_app_uchar(lstr, '\t');
+        else if (c == 'r') led_str_app_uchar(lstr, '\r');
+        else if (c == 'b') led_str_app_uchar(lstr, '\b');
+        else if (c == 'f') led_str_app_uchar(lstr, '\f');
+        else if (c == 'u' && i + 4 <= stop) {
+            char hex[5] = { str[i], str[i+1], str[i+2], str[i+3], '\0' };
+            uint32_t code = strtoul(hex, NULL, 16);
+            i += 4;
+            // surrogates pair
+            if (code >= 0xD800 && code < 0xDC00 && i + 6 <= stop && str[i] == '\\' && str[i+1] == 'u') {
+                char hexlow[5] = { str[i+2], str[i+3], str[i+4], str[i+5], '\0' };
+                uint32_t low = strtoul(hexlow, NULL, 16);
+                if (low >= 0xDC00 && low < 0xE000) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+            }
+            led_str_app_uchar(lstr, led_uchar_encode(code));
+        }
+        else led_str_app_uchar(lstr, (uint8_t)c);
+    }
+    return lstr;
+}
+
+//-----------------------------------------------
+// LED logfmt tokenizer
+//-----------------------------------------------
+
+size_t led_logfmt_split(const char* str, size_t len, led_kv_span_t* span, size_t max) {
+    size_t count = 0;
+    size_t i = 0;
+    while (count < max) {
+        while (i < len && led_uchar_isspace((uint8_t)str[i])) i++;
+        if (i >= len) break;
+        span[count].kstart = i;
+        while (i < len && str[i] != '=' && !led_uchar_isspace((uint8_t)str[i])) i++;
+        span[count].kstop = i;
+        // a key without '=' has an empty value
+        span[count].vstart = span[count].vstop = i;
+        if (i < len && str[i] == '=') {
+            span[count].vstart = ++i;
+            if (i < len && str[i] == '"') i = led_json_skip_str(str, len, i);
+            else while (i < len && !led_uchar_isspace((uint8_t)str[i])) i++;
+            span[count].vstop = i;
+        }
+        count++;
+    }
+    return count;
+}
+
+//-----------------------------------------------
+// LED base64, hex and url codecs, written in place with size check
+//-----------------------------------------------
+
+const char led_base64_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char led_base64url_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// both alphabets are decoded, 0xFF for the chars out of them
+const uint8_t led_base64_dtable[0x100] = {
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3E,0xFF,0x3E,0xFF,0x3F,
+    0x34,0x35,0x36,0x37,0x38,0x39,0x3A,0x3B,0x3C,0x3D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,
+    0x0F,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0xFF,0xFF,0xFF,0xFF,0x3F,
+    0xFF,0x1A,0x1B,0x1C,0x1D,0x1E,0x1F,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,
+    0x29,0x2A,0x2B,0x2C,0x2D,0x2E,0x2F,0x30,0x31,0x32,0x33,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+};
+
+bool led_str_base64_hw;
+
+void led_str_codec_init() {
+#ifdef LED_STR_X86
+    __builtin_cpu_init();
+    led_str_base64_hw = __builtin_cpu_supports("ssse3");
+#endif
+    led_debug("led_str_codec_init: base64 hw=%d", led_str_base64_hw);
+}
+
+#ifdef LED_STR_X86
+__attribute__((target("ssse3")))
+void led_str_base64_ssse3(const uint8_t* src, size_t* pi, size_t stop, char* dst, size_t* pj, size_t size, bool url) {
+    // 12 bytes give 16 sextets in bytes, shifted to their chars by a lookup on their range
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i shift = url
+        ? _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62, '_' - 63, 'A', 0, 0)
+        : _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    size_t i = *pi;
+    size_t j = *pj;
+    for (; i + 16 <= stop && j + 16 < size; i += 12, j += 16) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i)), shuffle);
+        __m128i hi = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        __m128i lo = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        __m128i idx = _mm_or_si128(hi, lo);
+        __m128i range = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+        range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+        _mm_storeu_si128((__m128i*)(dst + j), _mm_add_epi8(idx, _mm_shuffle_epi8(shift, range)));
+    }
+    *pi = i;
+    *pj = j;
+}
+
+__attribute__((target("ssse3")))
+void led_str_unbase64_ssse3(const uint8_t* src, size_t* pi, size_t stop, char* dst, size_t* pj, size_t size) {
+    // 16 chars of both alphabets give 12 bytes, the scalar path goes on from the first block with another char
+    size_t i = *pi;
+    size_t j = *pj;
+    for (; i + 16 <= stop && j + 16 < size; i += 16, j += 12) {
+        __m128i c = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), c));
+        __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), c));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), c));
+        __m128i plus = _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('+')), _mm_cmpeq_epi8(c, _mm_set1_epi8('-')));
+        __m128i slash = _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('/')), _mm_cmpeq_epi8(c, _mm_set1_epi8('_')));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(_mm_or_si128(digit, plus), slash))) != 0xFFFF)
+            break;
+        __m128i v = _mm_and_si128(upper, _mm_sub_epi8(c, _mm_set1_epi8('A')));
+        v = _mm_or_si128(v, _mm_and_si128(lower, _mm_sub_epi8(c, _mm_set1_epi8('a' - 26))));
+        v = _mm_or_si128(v, _mm_and_si128(digit, _mm_add_epi8(c, _mm_set1_epi8(52 - '0'))));
+        v = _mm_or_si128(v, _mm_and_si128(plus, _mm_set1_epi8(62)));
+        v = _mm_or_si128(v, _mm_and_si128(slash, _mm_set1_epi8(63)));
+        // sextets merged in pairs then in 24 bits, the 3 bytes of each 32 bits word stored big endian
+        v = _mm_madd_epi16(_mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+        v = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128((__m128i*)(dst + j), v);
+    }
+    *pi = i;
+    *pj = j;
+}
+#endif
+
+led_str_t* led_str_app_base64_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop, bool url) {
+    const char* table = url ? led_base64url_table : led_base64_table;
+    const uint8_t* src = (const uint8_t*)lstr_src->str;
+    char* dst = lstr->str;
+    size_t i = start;
+    size_t j = lstr->len;
+
+#ifdef LED_STR_X86
+    if (led_str_base64_hw)
+        led_str_base64_ssse3(src, &i, stop, dst, &j, lstr->size, url);
+#endif
+
+    // groups of 3 bytes as 24 bits give 4 chars
+    for (; i + 3 <= stop && j + 4 < lstr->size; i += 3, j += 4) {
+        uint32_t v = src[i] << 16 | src[i+1] << 8 | src[i+2];
+        dst[j] = table[v >> 18];
+        dst[j+1] = table[(v >> 12) & 0x3F];
+        dst[j+2] = table[(v >> 6) & 0x3F];
+        dst[j+3] = table[v & 0x3F];
+    }
+    // last group of 1 or 2 bytes, padded in the standard alphabet only
+    if (i < stop && i + 3 > stop && j + 4 < lstr->size) {
+        uint32_t v = src[i] << 16 | (i + 1 < stop ? src[i+1] << 8 : 0);
+        dst[j++] = table[v >> 18];
+        dst[j++] = table[(v >> 12) & 0x3F];
+        if (i + 1 < stop) dst[j++] = table[(v >> 6) & 0x3F];
+        else if (!url) dst[j++] = '=';
+        if (!url) dst[j++] = '=';
+    }
+    lstr->len = j;
+    lstr->str[lstr->len] = '\0';
+    return lstr;
+}
+
+led_str_t* led_str_app_unbase64_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    const uint8_t* src = (const uint8_t*)lstr_src->str;
+    char* dst = lstr->str;
+    size_t i = start;
+    size_t j = lstr->len;
+    uint32_t v = 0;
+    size_t n = 0;
+
+#ifdef LED_STR_X86
+    if (led_str_base64_hw)
+        led_str_unbase64_ssse3(src, &i, stop, dst, &j, lstr->size);
+#endif
+    while (i < stop && j + 3 < lstr->size) {
+        // fast path on 4 valid chars
+        if (n == 0 && i + 4 <= stop) {
+            uint8_t d0 = led_base64_dtable[src[i]], d1 = led_base64_dtable[src[i+1]];
+            uint8_t d2 = led_base64_dtable[src[i+2]], d3 = led_base64_dtable[src[i+3]];
+            if (!((d0 | d1 | d2 | d3) & 0xC0)) {
+                v = d0 << 18 | d1 << 12 | d2 << 6 | d3;
+                dst[j++] = v >> 16;
+                dst[j++] = v >> 8;
+                dst[j++] = v;
+                i += 4;
+                continue;
+            }
+        }
+        // chars out of the alphabet (padding, new lines) are skipped
+        uint8_t d = led_base64_dtable[src[i++]];
+        if (d == 0xFF) continue;
+        v = v << 6 | d;
+        if (++n == 4) {
+            dst[j++] = v >> 16;
+            dst[j++] = v >> 8;
+            dst[j++] = v;
+            v = n = 0;
+        }
+    }
+    // remaining bits of a last partial group
+    if (n == 2) dst[j++] = v >> 4;
+    else if (n == 3) {
+        dst[j++] = v >> 10;
+        dst[j++] = v >> 2;
+    }
+    lstr->len = j;
+    lstr->str[lstr->len] = '\0';
+    return lstr;
+}
+
+led_str_t* led_str_app_hex_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    const uint8_t* src = (const uint8_t*)lstr_src->str;
+    char* dst = lstr->str;
+    size_t i = start;
+    size_t j = lstr->len;
+#ifdef __SSE2__
+    // 16 bytes give 32 hex digits: nibbles interleaved, then '0' or 'a' - 10 added
+    __m128i vlow = _mm_set1_epi8(0x0F);
+    __m128i v9 = _mm_set1_epi8(9);
+    __m128i v0 = _mm_set1_epi8('0');
+    __m128i valpha = _mm_set1_epi8('a' - '0' - 10);
+    for (; i + 16 <= stop && j + 32 < lstr->size; i += 16, j += 32) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), vlow);
+        __m128i lo = _mm_and_si128(v, vlow);
+        __m128i h0 = _mm_unpacklo_epi8(hi, lo);
+        __m128i h1 = _mm_unpackhi_epi8(hi, lo);
+        h0 = _mm_add_epi8(_mm_add_epi8(h0, v0), _mm_and_si128(_mm_cmpgt_epi8(h0, v9), valpha));
+        h1 = _mm_add_epi8(_mm_add_epi8(h1, v0), _mm_and_si128(_mm_cmpgt_epi8(h1, v9), valpha));
+        _mm_storeu_si128((__m128i*)(dst + j), h0);
+        _mm_storeu_si128((__m128i*)(dst + j + 16), h1);
+    }
+#endif
+    for (; i < stop && j + 2 < lstr->size; i++, j += 2) {
+        dst[j] = "0123456789abcdef"[src[i] >> 4];
+        dst[j+1] = "0123456789abcdef"[src[i] & 0x0F];
+    }
+    lstr->len = j;
+    lstr->str[lstr->len] = '\0';
+    return lstr;
+}
+
+uint8_t led_hex_val(uint8_t c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0xFF;
+}
+
+led_str_t* led_str_app_unhex_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    const uint8_t* src = (const uint8_t*)lstr_src->str;
+    size_t i = start;
+    size_t j = lstr->len;
+
+    // chars out of hex digits are skipped like base64 decoding
+    uint8_t v = 0;
+    bool half = false;
+    for (; i < stop && j + 1 < lstr->size; i++) {
+        uint8_t d = led_hex_val(src[i]);
+        if (d == 0xFF) continue;
+        if (half) lstr->str[j++] = v << 4 | d;
+        else v = d;
+        half = !half;
+    }
+    lstr->len = j;
+    lstr->str[lstr->len] = '\0';
+    return lstr;
+}
+
+size_t led_str_unbase64_cut(char* str, size_t* len) {
+    size_t cut = 0, n = 0;
+    for (size_t i = 0; i < *len; i++)
+        if (led_base64_dtable[(uint8_t)str[i]] != 0xFF && n++ % 4 == 0) cut = i;
+    if (n % 4 == 0) return *len;
+    // the chars of the incomplete quad are kept after the cut, the skipped ones are dropped
+    size_t j = cut;
+    for (size_t i = cut; i < *len; i++)
+        if (led_base64_dtable[(uint8_t)str[i]] != 0xFF) str[j++] = str[i];
+    *len = j;
+    return cut;
+}
+
+size_t led_str_unhex_cut(char* str, size_t* len) {
+    size_t cut = 0, n = 0;
+    for (size_t i = 0; i < *len; i++)
+        if (led_hex_val(str[i]) != 0xFF && n++ % 2 == 0) cut = i;
+    if (n % 2 == 0) return *len;
+    size_t j = cut;
+    for (size_t i = cut; i < *len; i++)
+        if (led_hex_val(str[i]) != 0xFF) str[j++] = str[i];
+    *len = j;
+    return cut;
+}
+
+led_str_t* led_str_app_url_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    size_t i = start;
+    while (i < stop) {
+        // safe bytes copied at once, the next one percent encoded
+        size_t n = led_str_span_class(lstr_src->str + i, stop - i, &led_byte_class_url);
+        led_str_app_zn(lstr, lstr_src, i, i + n);
+        i += n;
+        if (i >= stop || led_str_isfull(lstr)) break;
+        uint8_t c = lstr_src->str[i++];
+        char pcbuf[4] = { '%', "0123456789ABCDEF"[c >> 4], "0123456789ABCDEF"[c & 0x0F], '\0' };
+        led_str_app_str(lstr, pcbuf);
+    }
+    return lstr;
+}
+
+led_str_t* led_str_app_unurl_zn(led_str_t* lstr, led_str_t* lstr_src, size_t start, size_t stop) {
+    size_t i = start;
+    while (i < stop) {
+        const char* ppc = memchr(lstr_src->str + i, '%', stop - i);
+        size_t ipc = ppc ? (size_t)(ppc - lstr_src->str) : stop;
+        led_str_app_zn(lstr, lstr_src, i, ipc);
+        i = ipc;
+        if (i >= stop || lstr->len + 1 >= lstr->size) break;
+        // an invalid percent sequence is kept unchanged
+        uint8_t h = i + 2 < stop ? led_hex_val(lstr_src->str[i+1]) : 0xFF;
+        uint8_t l = i + 2 < stop ? led_hex_val(lstr_src->str[i+2]) : 0xFF;
+        if ((h | l) & 0xF0) {
+            lstr->str[lstr->len++] = lstr_src->str[i++];
+        }
+        else {
+            lstr->str[lstr->len++] = h << 4 | l;
+            i += 3;
+        }
+        lstr->str[lstr->len] = '\0';
+    }
+    return lstr;
+}
+
 //-----------------------------------------------
 // LED utf8 functions
 //-----------------------------------------------
 
 size_t const led_uchar_size_table[] = {
-    1,1,1,1,1,1,1,1,0,0,0,0,2,2,3,4
+    1,1,1,1,1,1,1,1,1,1,1,1,2,2,3,4
+};
+
+const uint8_t led_uchar_class_table[0x80] = {
+    ['0' ... '9'] = LED_UCHAR_CLASS_DIGIT,
+    ['A' ... 'Z'] = LED_UCHAR_CLASS_UPPER,
+    ['a' ... 'z'] = LED_UCHAR_CLASS_LOWER,
+    [' '] = LED_UCHAR_CLASS_SPACE,
+    ['\t' ... '\r'] = LED_UCHAR_CLASS_SPACE,
 };
 
 size_t led_uchar_from_str(const char* str, led_uchar_t* puchar) {
@@ -126,25 +934,47 @@ size_t led_uchar_to_str(char* str, led_uchar_t uc) {
     return usize;
 }
 
-/* codepoints UFT-8 functions are not necessary but we let it if needed.
+void led_uchar_map_init(led_uchar_map_t* map) {
+    led_foreach_int(0x80)
+        map->ascii[foreach.i] = foreach.i;
+    memset(map->hash, 0, sizeof(map->hash));
+    map->hash_count = 0;
+    map->ascii_only = true;
+}
+
+void led_uchar_map_set(led_uchar_map_t* map, led_uchar_t uc, led_uchar_t uc_val) {
+    if (uc < 0x80) {
+        map->ascii[uc] = uc_val;
+        map->ascii_only = map->ascii_only && uc_val < 0x80;
+        return;
+    }
+    size_t i = led_uchar_map_pos(uc);
+    for (; map->hash[i].key && map->hash[i].key != uc; i = (i + 1) & (LED_UCHAR_MAP_HASH - 1));
+    if (!map->hash[i].key) {
+        // keep a quarter of the hash free to stay fast
+        led_assert(map->hash_count < LED_UCHAR_MAP_HASH * 3 / 4, LED_ERR_ARG, "Too many multi-bytes chars to map, max %d", LED_UCHAR_MAP_HASH * 3 / 4);
+        map->hash[i].key = uc;
+        map->hash_count++;
+    }
+    map->hash[i].val = uc_val;
+}
 
-bool led_uchar_isvalid(led_uchar_t uc)
-{
-  if (c <= 0x7F) return true;
+bool led_uchar_isvalid(led_uchar_t uc) {
+    if (uc <= 0x7F) return true;
 
-  if (0xC280 <= c && c <= 0xDFBF)
-     return ((c & 0xE0C0) == 0xC080);
+    if (0xC280 <= uc && uc <= 0xDFBF)
+        return ((uc & 0xE0C0) == 0xC080);
 
-  if (0xEDA080 <= c && c <= 0xEDBFBF)
-     return 0; // Reject UTF-16 surrogates
+    if (0xEDA080 <= uc && uc <= 0xEDBFBF)
+        return false; // Reject UTF-16 surrogates
 
-  if (0xE0A080 <= c && c <= 0xEFBFBF)
-     return ((c & 0xF0C0C0) == 0xE08080);
+    if (0xE0A080 <= uc && uc <= 0xEFBFBF)
+        return ((uc & 0xF0C0C0) == 0xE08080);
 
-  if (0xF0908080 <= c && c <= 0xF48FBFBF)
-     return ((c & 0xF8C0C0C0) == 0xF0808080);
+    if (0xF0908080 <= uc && uc <= 0xF48FBFBF)
+        return ((uc & 0xF8C0C0C0) == 0xF0808080);
 
-  return false;
+    return false;
 }
 
 led_uchar_t led_uchar_encode(uint32_t code) {
@@ -162,6 +992,8 @@ led_uchar_t led_uchar_encode(uint32_t code) {
     return uc;
 }
 
+/* codepoints UFT-8 functions are not necessary but we let it if needed.
+
 uint32_t led_uchar_decode(led_uchar_t uc) {
   uint32_t mask;
   if (c > 0x7F) {
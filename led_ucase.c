@@ -0,0 +1,1497 @@
+// Generated by led_ucase.py from Python unicodedata 14.0.0, do not edit.
+
+#include "led.h"
+
+const size_t led_ucase_stage1_size = 1958;
+
+const uint8_t led_ucase_stage1[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 20, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 0, 0, 25, 26, 0, 27, 28, 29, 30, 31, 32, 33, 34,
+    0, 0, 0, 0, 35, 36, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 38, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    40, 41, 42, 43, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0, 47, 48, 49, 50,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 54, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 61, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 63, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 66, 67,
+};
+
+const led_uchar_t led_ucase_lower[][64] = {
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xC3A0, 0xC3A1, 0xC3A2, 0xC3A3, 0xC3A4, 0xC3A5, 0xC3A6, 0xC3A7,
+        0xC3A8, 0xC3A9, 0xC3AA, 0xC3AB, 0xC3AC, 0xC3AD, 0xC3AE, 0xC3AF,
+        0xC3B0, 0xC3B1, 0xC3B2, 0xC3B3, 0xC3B4, 0xC3B5, 0xC3B6, 0x0,
+        0xC3B8, 0xC3B9, 0xC3BA, 0xC3BB, 0xC3BC, 0xC3BD, 0xC3BE, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xC481, 0x0, 0xC483, 0x0, 0xC485, 0x0, 0xC487, 0x0,
+        0xC489, 0x0, 0xC48B, 0x0, 0xC48D, 0x0, 0xC48F, 0x0,
+        0xC491, 0x0, 0xC493, 0x0, 0xC495, 0x0, 0xC497, 0x0,
+        0xC499, 0x0, 0xC49B, 0x0, 0xC49D, 0x0, 0xC49F, 0x0,
+        0xC4A1, 0x0, 0xC4A3, 0x0, 0xC4A5, 0x0, 0xC4A7, 0x0,
+        0xC4A9, 0x0, 0xC4AB, 0x0, 0xC4AD, 0x0, 0xC4AF, 0x0,
+        0x69, 0x0, 0xC4B3, 0x0, 0xC4B5, 0x0, 0xC4B7, 0x0,
+        0x0, 0xC4BA, 0x0, 0xC4BC, 0x0, 0xC4BE, 0x0, 0xC580,
+    },
+    {
+        0x0, 0xC582, 0x0, 0xC584, 0x0, 0xC586, 0x0, 0xC588,
+        0x0, 0x0, 0xC58B, 0x0, 0xC58D, 0x0, 0xC58F, 0x0,
+        0xC591, 0x0, 0xC593, 0x0, 0xC595, 0x0, 0xC597, 0x0,
+        0xC599, 0x0, 0xC59B, 0x0, 0xC59D, 0x0, 0xC59F, 0x0,
+        0xC5A1, 0x0, 0xC5A3, 0x0, 0xC5A5, 0x0, 0xC5A7, 0x0,
+        0xC5A9, 0x0, 0xC5AB, 0x0, 0xC5AD, 0x0, 0xC5AF, 0x0,
+        0xC5B1, 0x0, 0xC5B3, 0x0, 0xC5B5, 0x0, 0xC5B7, 0x0,
+        0xC3BF, 0xC5BA, 0x0, 0xC5BC, 0x0, 0xC5BE, 0x0, 0x0,
+    },
+    {
+        0x0, 0xC993, 0xC683, 0x0, 0xC685, 0x0, 0xC994, 0xC688,
+        0x0, 0xC996, 0xC997, 0xC68C, 0x0, 0x0, 0xC79D, 0xC999,
+        0xC99B, 0xC692, 0x0, 0xC9A0, 0xC9A3, 0x0, 0xC9A9, 0xC9A8,
+        0xC699, 0x0, 0x0, 0x0, 0xC9AF, 0xC9B2, 0x0, 0xC9B5,
+        0xC6A1, 0x0, 0xC6A3, 0x0, 0xC6A5, 0x0, 0xCA80, 0xC6A8,
+        0x0, 0xCA83, 0x0, 0x0, 0xC6AD, 0x0, 0xCA88, 0xC6B0,
+        0x0, 0xCA8A, 0xCA8B, 0xC6B4, 0x0, 0xC6B6, 0x0, 0xCA92,
+        0xC6B9, 0x0, 0x0, 0x0, 0xC6BD, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0xC786, 0xC786, 0x0, 0xC789,
+        0xC789, 0x0, 0xC78C, 0xC78C, 0x0, 0xC78E, 0x0, 0xC790,
+        0x0, 0xC792, 0x0, 0xC794, 0x0, 0xC796, 0x0, 0xC798,
+        0x0, 0xC79A, 0x0, 0xC79C, 0x0, 0x0, 0xC79F, 0x0,
+        0xC7A1, 0x0, 0xC7A3, 0x0, 0xC7A5, 0x0, 0xC7A7, 0x0,
+        0xC7A9, 0x0, 0xC7AB, 0x0, 0xC7AD, 0x0, 0xC7AF, 0x0,
+        0x0, 0xC7B3, 0xC7B3, 0x0, 0xC7B5, 0x0, 0xC695, 0xC6BF,
+        0xC7B9, 0x0, 0xC7BB, 0x0, 0xC7BD, 0x0, 0xC7BF, 0x0,
+    },
+    {
+        0xC881, 0x0, 0xC883, 0x0, 0xC885, 0x0, 0xC887, 0x0,
+        0xC889, 0x0, 0xC88B, 0x0, 0xC88D, 0x0, 0xC88F, 0x0,
+        0xC891, 0x0, 0xC893, 0x0, 0xC895, 0x0, 0xC897, 0x0,
+        0xC899, 0x0, 0xC89B, 0x0, 0xC89D, 0x0, 0xC89F, 0x0,
+        0xC69E, 0x0, 0xC8A3, 0x0, 0xC8A5, 0x0, 0xC8A7, 0x0,
+        0xC8A9, 0x0, 0xC8AB, 0x0, 0xC8AD, 0x0, 0xC8AF, 0x0,
+        0xC8B1, 0x0, 0xC8B3, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xE2B1A5, 0xC8BC, 0x0, 0xC69A, 0xE2B1A6, 0x0,
+    },
+    {
+        0x0, 0xC982, 0x0, 0xC680, 0xCA89, 0xCA8C, 0xC987, 0x0,
+        0xC989, 0x0, 0xC98B, 0x0, 0xC98D, 0x0, 0xC98F, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xCDB1, 0x0, 0xCDB3, 0x0, 0x0, 0x0, 0xCDB7, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCFB3,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCEAC, 0x0,
+        0xCEAD, 0xCEAE, 0xCEAF, 0x0, 0xCF8C, 0x0, 0xCF8D, 0xCF8E,
+        0x0, 0xCEB1, 0xCEB2, 0xCEB3, 0xCEB4, 0xCEB5, 0xCEB6, 0xCEB7,
+        0xCEB8, 0xCEB9, 0xCEBA, 0xCEBB, 0xCEBC, 0xCEBD, 0xCEBE, 0xCEBF,
+        0xCF80, 0xCF81, 0x0, 0xCF83, 0xCF84, 0xCF85, 0xCF86, 0xCF87,
+        0xCF88, 0xCF89, 0xCF8A, 0xCF8B, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCF97,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xCF99, 0x0, 0xCF9B, 0x0, 0xCF9D, 0x0, 0xCF9F, 0x0,
+        0xCFA1, 0x0, 0xCFA3, 0x0, 0xCFA5, 0x0, 0xCFA7, 0x0,
+        0xCFA9, 0x0, 0xCFAB, 0x0, 0xCFAD, 0x0, 0xCFAF, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0xCEB8, 0x0, 0x0, 0xCFB8,
+        0x0, 0xCFB2, 0xCFBB, 0x0, 0x0, 0xCDBB, 0xCDBC, 0xCDBD,
+    },
+    {
+        0xD190, 0xD191, 0xD192, 0xD193, 0xD194, 0xD195, 0xD196, 0xD197,
+        0xD198, 0xD199, 0xD19A, 0xD19B, 0xD19C, 0xD19D, 0xD19E, 0xD19F,
+        0xD0B0, 0xD0B1, 0xD0B2, 0xD0B3, 0xD0B4, 0xD0B5, 0xD0B6, 0xD0B7,
+        0xD0B8, 0xD0B9, 0xD0BA, 0xD0BB, 0xD0BC, 0xD0BD, 0xD0BE, 0xD0BF,
+        0xD180, 0xD181, 0xD182, 0xD183, 0xD184, 0xD185, 0xD186, 0xD187,
+        0xD188, 0xD189, 0xD18A, 0xD18B, 0xD18C, 0xD18D, 0xD18E, 0xD18F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xD1A1, 0x0, 0xD1A3, 0x0, 0xD1A5, 0x0, 0xD1A7, 0x0,
+        0xD1A9, 0x0, 0xD1AB, 0x0, 0xD1AD, 0x0, 0xD1AF, 0x0,
+        0xD1B1, 0x0, 0xD1B3, 0x0, 0xD1B5, 0x0, 0xD1B7, 0x0,
+        0xD1B9, 0x0, 0xD1BB, 0x0, 0xD1BD, 0x0, 0xD1BF, 0x0,
+    },
+    {
+        0xD281, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xD28B, 0x0, 0xD28D, 0x0, 0xD28F, 0x0,
+        0xD291, 0x0, 0xD293, 0x0, 0xD295, 0x0, 0xD297, 0x0,
+        0xD299, 0x0, 0xD29B, 0x0, 0xD29D, 0x0, 0xD29F, 0x0,
+        0xD2A1, 0x0, 0xD2A3, 0x0, 0xD2A5, 0x0, 0xD2A7, 0x0,
+        0xD2A9, 0x0, 0xD2AB, 0x0, 0xD2AD, 0x0, 0xD2AF, 0x0,
+        0xD2B1, 0x0, 0xD2B3, 0x0, 0xD2B5, 0x0, 0xD2B7, 0x0,
+        0xD2B9, 0x0, 0xD2BB, 0x0, 0xD2BD, 0x0, 0xD2BF, 0x0,
+    },
+    {
+        0xD38F, 0xD382, 0x0, 0xD384, 0x0, 0xD386, 0x0, 0xD388,
+        0x0, 0xD38A, 0x0, 0xD38C, 0x0, 0xD38E, 0x0, 0x0,
+        0xD391, 0x0, 0xD393, 0x0, 0xD395, 0x0, 0xD397, 0x0,
+        0xD399, 0x0, 0xD39B, 0x0, 0xD39D, 0x0, 0xD39F, 0x0,
+        0xD3A1, 0x0, 0xD3A3, 0x0, 0xD3A5, 0x0, 0xD3A7, 0x0,
+        0xD3A9, 0x0, 0xD3AB, 0x0, 0xD3AD, 0x0, 0xD3AF, 0x0,
+        0xD3B1, 0x0, 0xD3B3, 0x0, 0xD3B5, 0x0, 0xD3B7, 0x0,
+        0xD3B9, 0x0, 0xD3BB, 0x0, 0xD3BD, 0x0, 0xD3BF, 0x0,
+    },
+    {
+        0xD481, 0x0, 0xD483, 0x0, 0xD485, 0x0, 0xD487, 0x0,
+        0xD489, 0x0, 0xD48B, 0x0, 0xD48D, 0x0, 0xD48F, 0x0,
+        0xD491, 0x0, 0xD493, 0x0, 0xD495, 0x0, 0xD497, 0x0,
+        0xD499, 0x0, 0xD49B, 0x0, 0xD49D, 0x0, 0xD49F, 0x0,
+        0xD4A1, 0x0, 0xD4A3, 0x0, 0xD4A5, 0x0, 0xD4A7, 0x0,
+        0xD4A9, 0x0, 0xD4AB, 0x0, 0xD4AD, 0x0, 0xD4AF, 0x0,
+        0x0, 0xD5A1, 0xD5A2, 0xD5A3, 0xD5A4, 0xD5A5, 0xD5A6, 0xD5A7,
+        0xD5A8, 0xD5A9, 0xD5AA, 0xD5AB, 0xD5AC, 0xD5AD, 0xD5AE, 0xD5AF,
+    },
+    {
+        0xD5B0, 0xD5B1, 0xD5B2, 0xD5B3, 0xD5B4, 0xD5B5, 0xD5B6, 0xD5B7,
+        0xD5B8, 0xD5B9, 0xD5BA, 0xD5BB, 0xD5BC, 0xD5BD, 0xD5BE, 0xD5BF,
+        0xD680, 0xD681, 0xD682, 0xD683, 0xD684, 0xD685, 0xD686, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE2B480, 0xE2B481, 0xE2B482, 0xE2B483, 0xE2B484, 0xE2B485, 0xE2B486, 0xE2B487,
+        0xE2B488, 0xE2B489, 0xE2B48A, 0xE2B48B, 0xE2B48C, 0xE2B48D, 0xE2B48E, 0xE2B48F,
+        0xE2B490, 0xE2B491, 0xE2B492, 0xE2B493, 0xE2B494, 0xE2B495, 0xE2B496, 0xE2B497,
+        0xE2B498, 0xE2B499, 0xE2B49A, 0xE2B49B, 0xE2B49C, 0xE2B49D, 0xE2B49E, 0xE2B49F,
+    },
+    {
+        0xE2B4A0, 0xE2B4A1, 0xE2B4A2, 0xE2B4A3, 0xE2B4A4, 0xE2B4A5, 0x0, 0xE2B4A7,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xE2B4AD, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xEAADB0, 0xEAADB1, 0xEAADB2, 0xEAADB3, 0xEAADB4, 0xEAADB5, 0xEAADB6, 0xEAADB7,
+        0xEAADB8, 0xEAADB9, 0xEAADBA, 0xEAADBB, 0xEAADBC, 0xEAADBD, 0xEAADBE, 0xEAADBF,
+        0xEAAE80, 0xEAAE81, 0xEAAE82, 0xEAAE83, 0xEAAE84, 0xEAAE85, 0xEAAE86, 0xEAAE87,
+        0xEAAE88, 0xEAAE89, 0xEAAE8A, 0xEAAE8B, 0xEAAE8C, 0xEAAE8D, 0xEAAE8E, 0xEAAE8F,
+    },
+    {
+        0xEAAE90, 0xEAAE91, 0xEAAE92, 0xEAAE93, 0xEAAE94, 0xEAAE95, 0xEAAE96, 0xEAAE97,
+        0xEAAE98, 0xEAAE99, 0xEAAE9A, 0xEAAE9B, 0xEAAE9C, 0xEAAE9D, 0xEAAE9E, 0xEAAE9F,
+        0xEAAEA0, 0xEAAEA1, 0xEAAEA2, 0xEAAEA3, 0xEAAEA4, 0xEAAEA5, 0xEAAEA6, 0xEAAEA7,
+        0xEAAEA8, 0xEAAEA9, 0xEAAEAA, 0xEAAEAB, 0xEAAEAC, 0xEAAEAD, 0xEAAEAE, 0xEAAEAF,
+        0xEAAEB0, 0xEAAEB1, 0xEAAEB2, 0xEAAEB3, 0xEAAEB4, 0xEAAEB5, 0xEAAEB6, 0xEAAEB7,
+        0xEAAEB8, 0xEAAEB9, 0xEAAEBA, 0xEAAEBB, 0xEAAEBC, 0xEAAEBD, 0xEAAEBE, 0xEAAEBF,
+        0xE18FB8, 0xE18FB9, 0xE18FBA, 0xE18FBB, 0xE18FBC, 0xE18FBD, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE18390, 0xE18391, 0xE18392, 0xE18393, 0xE18394, 0xE18395, 0xE18396, 0xE18397,
+        0xE18398, 0xE18399, 0xE1839A, 0xE1839B, 0xE1839C, 0xE1839D, 0xE1839E, 0xE1839F,
+        0xE183A0, 0xE183A1, 0xE183A2, 0xE183A3, 0xE183A4, 0xE183A5, 0xE183A6, 0xE183A7,
+        0xE183A8, 0xE183A9, 0xE183AA, 0xE183AB, 0xE183AC, 0xE183AD, 0xE183AE, 0xE183AF,
+        0xE183B0, 0xE183B1, 0xE183B2, 0xE183B3, 0xE183B4, 0xE183B5, 0xE183B6, 0xE183B7,
+        0xE183B8, 0xE183B9, 0xE183BA, 0x0, 0x0, 0xE183BD, 0xE183BE, 0xE183BF,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xE1B881, 0x0, 0xE1B883, 0x0, 0xE1B885, 0x0, 0xE1B887, 0x0,
+        0xE1B889, 0x0, 0xE1B88B, 0x0, 0xE1B88D, 0x0, 0xE1B88F, 0x0,
+        0xE1B891, 0x0, 0xE1B893, 0x0, 0xE1B895, 0x0, 0xE1B897, 0x0,
+        0xE1B899, 0x0, 0xE1B89B, 0x0, 0xE1B89D, 0x0, 0xE1B89F, 0x0,
+        0xE1B8A1, 0x0, 0xE1B8A3, 0x0, 0xE1B8A5, 0x0, 0xE1B8A7, 0x0,
+        0xE1B8A9, 0x0, 0xE1B8AB, 0x0, 0xE1B8AD, 0x0, 0xE1B8AF, 0x0,
+        0xE1B8B1, 0x0, 0xE1B8B3, 0x0, 0xE1B8B5, 0x0, 0xE1B8B7, 0x0,
+        0xE1B8B9, 0x0, 0xE1B8BB, 0x0, 0xE1B8BD, 0x0, 0xE1B8BF, 0x0,
+    },
+    {
+        0xE1B981, 0x0, 0xE1B983, 0x0, 0xE1B985, 0x0, 0xE1B987, 0x0,
+        0xE1B989, 0x0, 0xE1B98B, 0x0, 0xE1B98D, 0x0, 0xE1B98F, 0x0,
+        0xE1B991, 0x0, 0xE1B993, 0x0, 0xE1B995, 0x0, 0xE1B997, 0x0,
+        0xE1B999, 0x0, 0xE1B99B, 0x0, 0xE1B99D, 0x0, 0xE1B99F, 0x0,
+        0xE1B9A1, 0x0, 0xE1B9A3, 0x0, 0xE1B9A5, 0x0, 0xE1B9A7, 0x0,
+        0xE1B9A9, 0x0, 0xE1B9AB, 0x0, 0xE1B9AD, 0x0, 0xE1B9AF, 0x0,
+        0xE1B9B1, 0x0, 0xE1B9B3, 0x0, 0xE1B9B5, 0x0, 0xE1B9B7, 0x0,
+        0xE1B9B9, 0x0, 0xE1B9BB, 0x0, 0xE1B9BD, 0x0, 0xE1B9BF, 0x0,
+    },
+    {
+        0xE1BA81, 0x0, 0xE1BA83, 0x0, 0xE1BA85, 0x0, 0xE1BA87, 0x0,
+        0xE1BA89, 0x0, 0xE1BA8B, 0x0, 0xE1BA8D, 0x0, 0xE1BA8F, 0x0,
+        0xE1BA91, 0x0, 0xE1BA93, 0x0, 0xE1BA95, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC39F, 0x0,
+        0xE1BAA1, 0x0, 0xE1BAA3, 0x0, 0xE1BAA5, 0x0, 0xE1BAA7, 0x0,
+        0xE1BAA9, 0x0, 0xE1BAAB, 0x0, 0xE1BAAD, 0x0, 0xE1BAAF, 0x0,
+        0xE1BAB1, 0x0, 0xE1BAB3, 0x0, 0xE1BAB5, 0x0, 0xE1BAB7, 0x0,
+        0xE1BAB9, 0x0, 0xE1BABB, 0x0, 0xE1BABD, 0x0, 0xE1BABF, 0x0,
+    },
+    {
+        0xE1BB81, 0x0, 0xE1BB83, 0x0, 0xE1BB85, 0x0, 0xE1BB87, 0x0,
+        0xE1BB89, 0x0, 0xE1BB8B, 0x0, 0xE1BB8D, 0x0, 0xE1BB8F, 0x0,
+        0xE1BB91, 0x0, 0xE1BB93, 0x0, 0xE1BB95, 0x0, 0xE1BB97, 0x0,
+        0xE1BB99, 0x0, 0xE1BB9B, 0x0, 0xE1BB9D, 0x0, 0xE1BB9F, 0x0,
+        0xE1BBA1, 0x0, 0xE1BBA3, 0x0, 0xE1BBA5, 0x0, 0xE1BBA7, 0x0,
+        0xE1BBA9, 0x0, 0xE1BBAB, 0x0, 0xE1BBAD, 0x0, 0xE1BBAF, 0x0,
+        0xE1BBB1, 0x0, 0xE1BBB3, 0x0, 0xE1BBB5, 0x0, 0xE1BBB7, 0x0,
+        0xE1BBB9, 0x0, 0xE1BBBB, 0x0, 0xE1BBBD, 0x0, 0xE1BBBF, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BC80, 0xE1BC81, 0xE1BC82, 0xE1BC83, 0xE1BC84, 0xE1BC85, 0xE1BC86, 0xE1BC87,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BC90, 0xE1BC91, 0xE1BC92, 0xE1BC93, 0xE1BC94, 0xE1BC95, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BCA0, 0xE1BCA1, 0xE1BCA2, 0xE1BCA3, 0xE1BCA4, 0xE1BCA5, 0xE1BCA6, 0xE1BCA7,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BCB0, 0xE1BCB1, 0xE1BCB2, 0xE1BCB3, 0xE1BCB4, 0xE1BCB5, 0xE1BCB6, 0xE1BCB7,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BD80, 0xE1BD81, 0xE1BD82, 0xE1BD83, 0xE1BD84, 0xE1BD85, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xE1BD91, 0x0, 0xE1BD93, 0x0, 0xE1BD95, 0x0, 0xE1BD97,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BDA0, 0xE1BDA1, 0xE1BDA2, 0xE1BDA3, 0xE1BDA4, 0xE1BDA5, 0xE1BDA6, 0xE1BDA7,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BE80, 0xE1BE81, 0xE1BE82, 0xE1BE83, 0xE1BE84, 0xE1BE85, 0xE1BE86, 0xE1BE87,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BE90, 0xE1BE91, 0xE1BE92, 0xE1BE93, 0xE1BE94, 0xE1BE95, 0xE1BE96, 0xE1BE97,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BEA0, 0xE1BEA1, 0xE1BEA2, 0xE1BEA3, 0xE1BEA4, 0xE1BEA5, 0xE1BEA6, 0xE1BEA7,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BEB0, 0xE1BEB1, 0xE1BDB0, 0xE1BDB1, 0xE1BEB3, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BDB2, 0xE1BDB3, 0xE1BDB4, 0xE1BDB5, 0xE1BF83, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BF90, 0xE1BF91, 0xE1BDB6, 0xE1BDB7, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BFA0, 0xE1BFA1, 0xE1BDBA, 0xE1BDBB, 0xE1BFA5, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BDB8, 0xE1BDB9, 0xE1BDBC, 0xE1BDBD, 0xE1BFB3, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCF89, 0x0,
+        0x0, 0x0, 0x6B, 0xC3A5, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xE2858E, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE285B0, 0xE285B1, 0xE285B2, 0xE285B3, 0xE285B4, 0xE285B5, 0xE285B6, 0xE285B7,
+        0xE285B8, 0xE285B9, 0xE285BA, 0xE285BB, 0xE285BC, 0xE285BD, 0xE285BE, 0xE285BF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0xE28684, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE29390, 0xE29391,
+        0xE29392, 0xE29393, 0xE29394, 0xE29395, 0xE29396, 0xE29397, 0xE29398, 0xE29399,
+    },
+    {
+        0xE2939A, 0xE2939B, 0xE2939C, 0xE2939D, 0xE2939E, 0xE2939F, 0xE293A0, 0xE293A1,
+        0xE293A2, 0xE293A3, 0xE293A4, 0xE293A5, 0xE293A6, 0xE293A7, 0xE293A8, 0xE293A9,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xE2B0B0, 0xE2B0B1, 0xE2B0B2, 0xE2B0B3, 0xE2B0B4, 0xE2B0B5, 0xE2B0B6, 0xE2B0B7,
+        0xE2B0B8, 0xE2B0B9, 0xE2B0BA, 0xE2B0BB, 0xE2B0BC, 0xE2B0BD, 0xE2B0BE, 0xE2B0BF,
+        0xE2B180, 0xE2B181, 0xE2B182, 0xE2B183, 0xE2B184, 0xE2B185, 0xE2B186, 0xE2B187,
+        0xE2B188, 0xE2B189, 0xE2B18A, 0xE2B18B, 0xE2B18C, 0xE2B18D, 0xE2B18E, 0xE2B18F,
+        0xE2B190, 0xE2B191, 0xE2B192, 0xE2B193, 0xE2B194, 0xE2B195, 0xE2B196, 0xE2B197,
+        0xE2B198, 0xE2B199, 0xE2B19A, 0xE2B19B, 0xE2B19C, 0xE2B19D, 0xE2B19E, 0xE2B19F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE2B1A1, 0x0, 0xC9AB, 0xE1B5BD, 0xC9BD, 0x0, 0x0, 0xE2B1A8,
+        0x0, 0xE2B1AA, 0x0, 0xE2B1AC, 0x0, 0xC991, 0xC9B1, 0xC990,
+        0xC992, 0x0, 0xE2B1B3, 0x0, 0x0, 0xE2B1B6, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC8BF, 0xC980,
+    },
+    {
+        0xE2B281, 0x0, 0xE2B283, 0x0, 0xE2B285, 0x0, 0xE2B287, 0x0,
+        0xE2B289, 0x0, 0xE2B28B, 0x0, 0xE2B28D, 0x0, 0xE2B28F, 0x0,
+        0xE2B291, 0x0, 0xE2B293, 0x0, 0xE2B295, 0x0, 0xE2B297, 0x0,
+        0xE2B299, 0x0, 0xE2B29B, 0x0, 0xE2B29D, 0x0, 0xE2B29F, 0x0,
+        0xE2B2A1, 0x0, 0xE2B2A3, 0x0, 0xE2B2A5, 0x0, 0xE2B2A7, 0x0,
+        0xE2B2A9, 0x0, 0xE2B2AB, 0x0, 0xE2B2AD, 0x0, 0xE2B2AF, 0x0,
+        0xE2B2B1, 0x0, 0xE2B2B3, 0x0, 0xE2B2B5, 0x0, 0xE2B2B7, 0x0,
+        0xE2B2B9, 0x0, 0xE2B2BB, 0x0, 0xE2B2BD, 0x0, 0xE2B2BF, 0x0,
+    },
+    {
+        0xE2B381, 0x0, 0xE2B383, 0x0, 0xE2B385, 0x0, 0xE2B387, 0x0,
+        0xE2B389, 0x0, 0xE2B38B, 0x0, 0xE2B38D, 0x0, 0xE2B38F, 0x0,
+        0xE2B391, 0x0, 0xE2B393, 0x0, 0xE2B395, 0x0, 0xE2B397, 0x0,
+        0xE2B399, 0x0, 0xE2B39B, 0x0, 0xE2B39D, 0x0, 0xE2B39F, 0x0,
+        0xE2B3A1, 0x0, 0xE2B3A3, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xE2B3AC, 0x0, 0xE2B3AE, 0x0, 0x0,
+        0x0, 0x0, 0xE2B3B3, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xEA9981, 0x0, 0xEA9983, 0x0, 0xEA9985, 0x0, 0xEA9987, 0x0,
+        0xEA9989, 0x0, 0xEA998B, 0x0, 0xEA998D, 0x0, 0xEA998F, 0x0,
+        0xEA9991, 0x0, 0xEA9993, 0x0, 0xEA9995, 0x0, 0xEA9997, 0x0,
+        0xEA9999, 0x0, 0xEA999B, 0x0, 0xEA999D, 0x0, 0xEA999F, 0x0,
+        0xEA99A1, 0x0, 0xEA99A3, 0x0, 0xEA99A5, 0x0, 0xEA99A7, 0x0,
+        0xEA99A9, 0x0, 0xEA99AB, 0x0, 0xEA99AD, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xEA9A81, 0x0, 0xEA9A83, 0x0, 0xEA9A85, 0x0, 0xEA9A87, 0x0,
+        0xEA9A89, 0x0, 0xEA9A8B, 0x0, 0xEA9A8D, 0x0, 0xEA9A8F, 0x0,
+        0xEA9A91, 0x0, 0xEA9A93, 0x0, 0xEA9A95, 0x0, 0xEA9A97, 0x0,
+        0xEA9A99, 0x0, 0xEA9A9B, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xEA9CA3, 0x0, 0xEA9CA5, 0x0, 0xEA9CA7, 0x0,
+        0xEA9CA9, 0x0, 0xEA9CAB, 0x0, 0xEA9CAD, 0x0, 0xEA9CAF, 0x0,
+        0x0, 0x0, 0xEA9CB3, 0x0, 0xEA9CB5, 0x0, 0xEA9CB7, 0x0,
+        0xEA9CB9, 0x0, 0xEA9CBB, 0x0, 0xEA9CBD, 0x0, 0xEA9CBF, 0x0,
+    },
+    {
+        0xEA9D81, 0x0, 0xEA9D83, 0x0, 0xEA9D85, 0x0, 0xEA9D87, 0x0,
+        0xEA9D89, 0x0, 0xEA9D8B, 0x0, 0xEA9D8D, 0x0, 0xEA9D8F, 0x0,
+        0xEA9D91, 0x0, 0xEA9D93, 0x0, 0xEA9D95, 0x0, 0xEA9D97, 0x0,
+        0xEA9D99, 0x0, 0xEA9D9B, 0x0, 0xEA9D9D, 0x0, 0xEA9D9F, 0x0,
+        0xEA9DA1, 0x0, 0xEA9DA3, 0x0, 0xEA9DA5, 0x0, 0xEA9DA7, 0x0,
+        0xEA9DA9, 0x0, 0xEA9DAB, 0x0, 0xEA9DAD, 0x0, 0xEA9DAF, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xEA9DBA, 0x0, 0xEA9DBC, 0x0, 0xE1B5B9, 0xEA9DBF, 0x0,
+    },
+    {
+        0xEA9E81, 0x0, 0xEA9E83, 0x0, 0xEA9E85, 0x0, 0xEA9E87, 0x0,
+        0x0, 0x0, 0x0, 0xEA9E8C, 0x0, 0xC9A5, 0x0, 0x0,
+        0xEA9E91, 0x0, 0xEA9E93, 0x0, 0x0, 0x0, 0xEA9E97, 0x0,
+        0xEA9E99, 0x0, 0xEA9E9B, 0x0, 0xEA9E9D, 0x0, 0xEA9E9F, 0x0,
+        0xEA9EA1, 0x0, 0xEA9EA3, 0x0, 0xEA9EA5, 0x0, 0xEA9EA7, 0x0,
+        0xEA9EA9, 0x0, 0xC9A6, 0xC99C, 0xC9A1, 0xC9AC, 0xC9AA, 0x0,
+        0xCA9E, 0xCA87, 0xCA9D, 0xEAAD93, 0xEA9EB5, 0x0, 0xEA9EB7, 0x0,
+        0xEA9EB9, 0x0, 0xEA9EBB, 0x0, 0xEA9EBD, 0x0, 0xEA9EBF, 0x0,
+    },
+    {
+        0xEA9F81, 0x0, 0xEA9F83, 0x0, 0xEA9E94, 0xCA82, 0xE1B68E, 0xEA9F88,
+        0x0, 0xEA9F8A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xEA9F91, 0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9F97, 0x0,
+        0xEA9F99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9FB6, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xEFBD81, 0xEFBD82, 0xEFBD83, 0xEFBD84, 0xEFBD85, 0xEFBD86, 0xEFBD87,
+        0xEFBD88, 0xEFBD89, 0xEFBD8A, 0xEFBD8B, 0xEFBD8C, 0xEFBD8D, 0xEFBD8E, 0xEFBD8F,
+        0xEFBD90, 0xEFBD91, 0xEFBD92, 0xEFBD93, 0xEFBD94, 0xEFBD95, 0xEFBD96, 0xEFBD97,
+        0xEFBD98, 0xEFBD99, 0xEFBD9A, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xF09090A8, 0xF09090A9, 0xF09090AA, 0xF09090AB, 0xF09090AC, 0xF09090AD, 0xF09090AE, 0xF09090AF,
+        0xF09090B0, 0xF09090B1, 0xF09090B2, 0xF09090B3, 0xF09090B4, 0xF09090B5, 0xF09090B6, 0xF09090B7,
+        0xF09090B8, 0xF09090B9, 0xF09090BA, 0xF09090BB, 0xF09090BC, 0xF09090BD, 0xF09090BE, 0xF09090BF,
+        0xF0909180, 0xF0909181, 0xF0909182, 0xF0909183, 0xF0909184, 0xF0909185, 0xF0909186, 0xF0909187,
+        0xF0909188, 0xF0909189, 0xF090918A, 0xF090918B, 0xF090918C, 0xF090918D, 0xF090918E, 0xF090918F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xF0909398, 0xF0909399, 0xF090939A, 0xF090939B, 0xF090939C, 0xF090939D, 0xF090939E, 0xF090939F,
+        0xF09093A0, 0xF09093A1, 0xF09093A2, 0xF09093A3, 0xF09093A4, 0xF09093A5, 0xF09093A6, 0xF09093A7,
+    },
+    {
+        0xF09093A8, 0xF09093A9, 0xF09093AA, 0xF09093AB, 0xF09093AC, 0xF09093AD, 0xF09093AE, 0xF09093AF,
+        0xF09093B0, 0xF09093B1, 0xF09093B2, 0xF09093B3, 0xF09093B4, 0xF09093B5, 0xF09093B6, 0xF09093B7,
+        0xF09093B8, 0xF09093B9, 0xF09093BA, 0xF09093BB, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xF0909697, 0xF0909698, 0xF0909699, 0xF090969A, 0xF090969B, 0xF090969C, 0xF090969D, 0xF090969E,
+        0xF090969F, 0xF09096A0, 0xF09096A1, 0x0, 0xF09096A3, 0xF09096A4, 0xF09096A5, 0xF09096A6,
+    },
+    {
+        0xF09096A7, 0xF09096A8, 0xF09096A9, 0xF09096AA, 0xF09096AB, 0xF09096AC, 0xF09096AD, 0xF09096AE,
+        0xF09096AF, 0xF09096B0, 0xF09096B1, 0x0, 0xF09096B3, 0xF09096B4, 0xF09096B5, 0xF09096B6,
+        0xF09096B7, 0xF09096B8, 0xF09096B9, 0x0, 0xF09096BB, 0xF09096BC, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xF090B380, 0xF090B381, 0xF090B382, 0xF090B383, 0xF090B384, 0xF090B385, 0xF090B386, 0xF090B387,
+        0xF090B388, 0xF090B389, 0xF090B38A, 0xF090B38B, 0xF090B38C, 0xF090B38D, 0xF090B38E, 0xF090B38F,
+        0xF090B390, 0xF090B391, 0xF090B392, 0xF090B393, 0xF090B394, 0xF090B395, 0xF090B396, 0xF090B397,
+        0xF090B398, 0xF090B399, 0xF090B39A, 0xF090B39B, 0xF090B39C, 0xF090B39D, 0xF090B39E, 0xF090B39F,
+        0xF090B3A0, 0xF090B3A1, 0xF090B3A2, 0xF090B3A3, 0xF090B3A4, 0xF090B3A5, 0xF090B3A6, 0xF090B3A7,
+        0xF090B3A8, 0xF090B3A9, 0xF090B3AA, 0xF090B3AB, 0xF090B3AC, 0xF090B3AD, 0xF090B3AE, 0xF090B3AF,
+        0xF090B3B0, 0xF090B3B1, 0xF090B3B2, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xF091A380, 0xF091A381, 0xF091A382, 0xF091A383, 0xF091A384, 0xF091A385, 0xF091A386, 0xF091A387,
+        0xF091A388, 0xF091A389, 0xF091A38A, 0xF091A38B, 0xF091A38C, 0xF091A38D, 0xF091A38E, 0xF091A38F,
+        0xF091A390, 0xF091A391, 0xF091A392, 0xF091A393, 0xF091A394, 0xF091A395, 0xF091A396, 0xF091A397,
+        0xF091A398, 0xF091A399, 0xF091A39A, 0xF091A39B, 0xF091A39C, 0xF091A39D, 0xF091A39E, 0xF091A39F,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xF096B9A0, 0xF096B9A1, 0xF096B9A2, 0xF096B9A3, 0xF096B9A4, 0xF096B9A5, 0xF096B9A6, 0xF096B9A7,
+        0xF096B9A8, 0xF096B9A9, 0xF096B9AA, 0xF096B9AB, 0xF096B9AC, 0xF096B9AD, 0xF096B9AE, 0xF096B9AF,
+        0xF096B9B0, 0xF096B9B1, 0xF096B9B2, 0xF096B9B3, 0xF096B9B4, 0xF096B9B5, 0xF096B9B6, 0xF096B9B7,
+        0xF096B9B8, 0xF096B9B9, 0xF096B9BA, 0xF096B9BB, 0xF096B9BC, 0xF096B9BD, 0xF096B9BE, 0xF096B9BF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xF09EA4A2, 0xF09EA4A3, 0xF09EA4A4, 0xF09EA4A5, 0xF09EA4A6, 0xF09EA4A7, 0xF09EA4A8, 0xF09EA4A9,
+        0xF09EA4AA, 0xF09EA4AB, 0xF09EA4AC, 0xF09EA4AD, 0xF09EA4AE, 0xF09EA4AF, 0xF09EA4B0, 0xF09EA4B1,
+        0xF09EA4B2, 0xF09EA4B3, 0xF09EA4B4, 0xF09EA4B5, 0xF09EA4B6, 0xF09EA4B7, 0xF09EA4B8, 0xF09EA4B9,
+        0xF09EA4BA, 0xF09EA4BB, 0xF09EA4BC, 0xF09EA4BD, 0xF09EA4BE, 0xF09EA4BF, 0xF09EA580, 0xF09EA581,
+        0xF09EA582, 0xF09EA583, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+};
+
+const led_uchar_t led_ucase_upper[][64] = {
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xCE9C, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xC380, 0xC381, 0xC382, 0xC383, 0xC384, 0xC385, 0xC386, 0xC387,
+        0xC388, 0xC389, 0xC38A, 0xC38B, 0xC38C, 0xC38D, 0xC38E, 0xC38F,
+        0xC390, 0xC391, 0xC392, 0xC393, 0xC394, 0xC395, 0xC396, 0x0,
+        0xC398, 0xC399, 0xC39A, 0xC39B, 0xC39C, 0xC39D, 0xC39E, 0xC5B8,
+    },
+    {
+        0x0, 0xC480, 0x0, 0xC482, 0x0, 0xC484, 0x0, 0xC486,
+        0x0, 0xC488, 0x0, 0xC48A, 0x0, 0xC48C, 0x0, 0xC48E,
+        0x0, 0xC490, 0x0, 0xC492, 0x0, 0xC494, 0x0, 0xC496,
+        0x0, 0xC498, 0x0, 0xC49A, 0x0, 0xC49C, 0x0, 0xC49E,
+        0x0, 0xC4A0, 0x0, 0xC4A2, 0x0, 0xC4A4, 0x0, 0xC4A6,
+        0x0, 0xC4A8, 0x0, 0xC4AA, 0x0, 0xC4AC, 0x0, 0xC4AE,
+        0x0, 0x49, 0x0, 0xC4B2, 0x0, 0xC4B4, 0x0, 0xC4B6,
+        0x0, 0x0, 0xC4B9, 0x0, 0xC4BB, 0x0, 0xC4BD, 0x0,
+    },
+    {
+        0xC4BF, 0x0, 0xC581, 0x0, 0xC583, 0x0, 0xC585, 0x0,
+        0xC587, 0x0, 0x0, 0xC58A, 0x0, 0xC58C, 0x0, 0xC58E,
+        0x0, 0xC590, 0x0, 0xC592, 0x0, 0xC594, 0x0, 0xC596,
+        0x0, 0xC598, 0x0, 0xC59A, 0x0, 0xC59C, 0x0, 0xC59E,
+        0x0, 0xC5A0, 0x0, 0xC5A2, 0x0, 0xC5A4, 0x0, 0xC5A6,
+        0x0, 0xC5A8, 0x0, 0xC5AA, 0x0, 0xC5AC, 0x0, 0xC5AE,
+        0x0, 0xC5B0, 0x0, 0xC5B2, 0x0, 0xC5B4, 0x0, 0xC5B6,
+        0x0, 0x0, 0xC5B9, 0x0, 0xC5BB, 0x0, 0xC5BD, 0x53,
+    },
+    {
+        0xC983, 0x0, 0x0, 0xC682, 0x0, 0xC684, 0x0, 0x0,
+        0xC687, 0x0, 0x0, 0x0, 0xC68B, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xC691, 0x0, 0x0, 0xC7B6, 0x0, 0x0,
+        0x0, 0xC698, 0xC8BD, 0x0, 0x0, 0x0, 0xC8A0, 0x0,
+        0x0, 0xC6A0, 0x0, 0xC6A2, 0x0, 0xC6A4, 0x0, 0x0,
+        0xC6A7, 0x0, 0x0, 0x0, 0x0, 0xC6AC, 0x0, 0x0,
+        0xC6AF, 0x0, 0x0, 0x0, 0xC6B3, 0x0, 0xC6B5, 0x0,
+        0x0, 0xC6B8, 0x0, 0x0, 0x0, 0xC6BC, 0x0, 0xC7B7,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xC784, 0xC784, 0x0,
+        0xC787, 0xC787, 0x0, 0xC78A, 0xC78A, 0x0, 0xC78D, 0x0,
+        0xC78F, 0x0, 0xC791, 0x0, 0xC793, 0x0, 0xC795, 0x0,
+        0xC797, 0x0, 0xC799, 0x0, 0xC79B, 0xC68E, 0x0, 0xC79E,
+        0x0, 0xC7A0, 0x0, 0xC7A2, 0x0, 0xC7A4, 0x0, 0xC7A6,
+        0x0, 0xC7A8, 0x0, 0xC7AA, 0x0, 0xC7AC, 0x0, 0xC7AE,
+        0x0, 0x0, 0xC7B1, 0xC7B1, 0x0, 0xC7B4, 0x0, 0x0,
+        0x0, 0xC7B8, 0x0, 0xC7BA, 0x0, 0xC7BC, 0x0, 0xC7BE,
+    },
+    {
+        0x0, 0xC880, 0x0, 0xC882, 0x0, 0xC884, 0x0, 0xC886,
+        0x0, 0xC888, 0x0, 0xC88A, 0x0, 0xC88C, 0x0, 0xC88E,
+        0x0, 0xC890, 0x0, 0xC892, 0x0, 0xC894, 0x0, 0xC896,
+        0x0, 0xC898, 0x0, 0xC89A, 0x0, 0xC89C, 0x0, 0xC89E,
+        0x0, 0x0, 0x0, 0xC8A2, 0x0, 0xC8A4, 0x0, 0xC8A6,
+        0x0, 0xC8A8, 0x0, 0xC8AA, 0x0, 0xC8AC, 0x0, 0xC8AE,
+        0x0, 0xC8B0, 0x0, 0xC8B2, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0xC8BB, 0x0, 0x0, 0xE2B1BE,
+    },
+    {
+        0xE2B1BF, 0x0, 0xC981, 0x0, 0x0, 0x0, 0x0, 0xC986,
+        0x0, 0xC988, 0x0, 0xC98A, 0x0, 0xC98C, 0x0, 0xC98E,
+        0xE2B1AF, 0xE2B1AD, 0xE2B1B0, 0xC681, 0xC686, 0x0, 0xC689, 0xC68A,
+        0x0, 0xC68F, 0x0, 0xC690, 0xEA9EAB, 0x0, 0x0, 0x0,
+        0xC693, 0xEA9EAC, 0x0, 0xC694, 0x0, 0xEA9E8D, 0xEA9EAA, 0x0,
+        0xC697, 0xC696, 0xEA9EAE, 0xE2B1A2, 0xEA9EAD, 0x0, 0x0, 0xC69C,
+        0x0, 0xE2B1AE, 0xC69D, 0x0, 0x0, 0xC69F, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xE2B1A4, 0x0, 0x0,
+    },
+    {
+        0xC6A6, 0x0, 0xEA9F85, 0xC6A9, 0x0, 0x0, 0x0, 0xEA9EB1,
+        0xC6AE, 0xC984, 0xC6B1, 0xC6B2, 0xC985, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xC6B7, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9EB2, 0xEA9EB0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xCE99, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xCDB0, 0x0, 0xCDB2, 0x0, 0x0, 0x0, 0xCDB6,
+        0x0, 0x0, 0x0, 0xCFBD, 0xCFBE, 0xCFBF, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0xCE86, 0xCE88, 0xCE89, 0xCE8A,
+        0x0, 0xCE91, 0xCE92, 0xCE93, 0xCE94, 0xCE95, 0xCE96, 0xCE97,
+        0xCE98, 0xCE99, 0xCE9A, 0xCE9B, 0xCE9C, 0xCE9D, 0xCE9E, 0xCE9F,
+    },
+    {
+        0xCEA0, 0xCEA1, 0xCEA3, 0xCEA3, 0xCEA4, 0xCEA5, 0xCEA6, 0xCEA7,
+        0xCEA8, 0xCEA9, 0xCEAA, 0xCEAB, 0xCE8C, 0xCE8E, 0xCE8F, 0x0,
+        0xCE92, 0xCE98, 0x0, 0x0, 0x0, 0xCEA6, 0xCEA0, 0xCF8F,
+        0x0, 0xCF98, 0x0, 0xCF9A, 0x0, 0xCF9C, 0x0, 0xCF9E,
+        0x0, 0xCFA0, 0x0, 0xCFA2, 0x0, 0xCFA4, 0x0, 0xCFA6,
+        0x0, 0xCFA8, 0x0, 0xCFAA, 0x0, 0xCFAC, 0x0, 0xCFAE,
+        0xCE9A, 0xCEA1, 0xCFB9, 0xCDBF, 0x0, 0xCE95, 0x0, 0x0,
+        0xCFB7, 0x0, 0x0, 0xCFBA, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xD090, 0xD091, 0xD092, 0xD093, 0xD094, 0xD095, 0xD096, 0xD097,
+        0xD098, 0xD099, 0xD09A, 0xD09B, 0xD09C, 0xD09D, 0xD09E, 0xD09F,
+    },
+    {
+        0xD0A0, 0xD0A1, 0xD0A2, 0xD0A3, 0xD0A4, 0xD0A5, 0xD0A6, 0xD0A7,
+        0xD0A8, 0xD0A9, 0xD0AA, 0xD0AB, 0xD0AC, 0xD0AD, 0xD0AE, 0xD0AF,
+        0xD080, 0xD081, 0xD082, 0xD083, 0xD084, 0xD085, 0xD086, 0xD087,
+        0xD088, 0xD089, 0xD08A, 0xD08B, 0xD08C, 0xD08D, 0xD08E, 0xD08F,
+        0x0, 0xD1A0, 0x0, 0xD1A2, 0x0, 0xD1A4, 0x0, 0xD1A6,
+        0x0, 0xD1A8, 0x0, 0xD1AA, 0x0, 0xD1AC, 0x0, 0xD1AE,
+        0x0, 0xD1B0, 0x0, 0xD1B2, 0x0, 0xD1B4, 0x0, 0xD1B6,
+        0x0, 0xD1B8, 0x0, 0xD1BA, 0x0, 0xD1BC, 0x0, 0xD1BE,
+    },
+    {
+        0x0, 0xD280, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xD28A, 0x0, 0xD28C, 0x0, 0xD28E,
+        0x0, 0xD290, 0x0, 0xD292, 0x0, 0xD294, 0x0, 0xD296,
+        0x0, 0xD298, 0x0, 0xD29A, 0x0, 0xD29C, 0x0, 0xD29E,
+        0x0, 0xD2A0, 0x0, 0xD2A2, 0x0, 0xD2A4, 0x0, 0xD2A6,
+        0x0, 0xD2A8, 0x0, 0xD2AA, 0x0, 0xD2AC, 0x0, 0xD2AE,
+        0x0, 0xD2B0, 0x0, 0xD2B2, 0x0, 0xD2B4, 0x0, 0xD2B6,
+        0x0, 0xD2B8, 0x0, 0xD2BA, 0x0, 0xD2BC, 0x0, 0xD2BE,
+    },
+    {
+        0x0, 0x0, 0xD381, 0x0, 0xD383, 0x0, 0xD385, 0x0,
+        0xD387, 0x0, 0xD389, 0x0, 0xD38B, 0x0, 0xD38D, 0xD380,
+        0x0, 0xD390, 0x0, 0xD392, 0x0, 0xD394, 0x0, 0xD396,
+        0x0, 0xD398, 0x0, 0xD39A, 0x0, 0xD39C, 0x0, 0xD39E,
+        0x0, 0xD3A0, 0x0, 0xD3A2, 0x0, 0xD3A4, 0x0, 0xD3A6,
+        0x0, 0xD3A8, 0x0, 0xD3AA, 0x0, 0xD3AC, 0x0, 0xD3AE,
+        0x0, 0xD3B0, 0x0, 0xD3B2, 0x0, 0xD3B4, 0x0, 0xD3B6,
+        0x0, 0xD3B8, 0x0, 0xD3BA, 0x0, 0xD3BC, 0x0, 0xD3BE,
+    },
+    {
+        0x0, 0xD480, 0x0, 0xD482, 0x0, 0xD484, 0x0, 0xD486,
+        0x0, 0xD488, 0x0, 0xD48A, 0x0, 0xD48C, 0x0, 0xD48E,
+        0x0, 0xD490, 0x0, 0xD492, 0x0, 0xD494, 0x0, 0xD496,
+        0x0, 0xD498, 0x0, 0xD49A, 0x0, 0xD49C, 0x0, 0xD49E,
+        0x0, 0xD4A0, 0x0, 0xD4A2, 0x0, 0xD4A4, 0x0, 0xD4A6,
+        0x0, 0xD4A8, 0x0, 0xD4AA, 0x0, 0xD4AC, 0x0, 0xD4AE,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xD4B1, 0xD4B2, 0xD4B3, 0xD4B4, 0xD4B5, 0xD4B6, 0xD4B7,
+        0xD4B8, 0xD4B9, 0xD4BA, 0xD4BB, 0xD4BC, 0xD4BD, 0xD4BE, 0xD4BF,
+        0xD580, 0xD581, 0xD582, 0xD583, 0xD584, 0xD585, 0xD586, 0xD587,
+        0xD588, 0xD589, 0xD58A, 0xD58B, 0xD58C, 0xD58D, 0xD58E, 0xD58F,
+    },
+    {
+        0xD590, 0xD591, 0xD592, 0xD593, 0xD594, 0xD595, 0xD596, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1B290, 0xE1B291, 0xE1B292, 0xE1B293, 0xE1B294, 0xE1B295, 0xE1B296, 0xE1B297,
+        0xE1B298, 0xE1B299, 0xE1B29A, 0xE1B29B, 0xE1B29C, 0xE1B29D, 0xE1B29E, 0xE1B29F,
+        0xE1B2A0, 0xE1B2A1, 0xE1B2A2, 0xE1B2A3, 0xE1B2A4, 0xE1B2A5, 0xE1B2A6, 0xE1B2A7,
+        0xE1B2A8, 0xE1B2A9, 0xE1B2AA, 0xE1B2AB, 0xE1B2AC, 0xE1B2AD, 0xE1B2AE, 0xE1B2AF,
+        0xE1B2B0, 0xE1B2B1, 0xE1B2B2, 0xE1B2B3, 0xE1B2B4, 0xE1B2B5, 0xE1B2B6, 0xE1B2B7,
+        0xE1B2B8, 0xE1B2B9, 0xE1B2BA, 0x0, 0x0, 0xE1B2BD, 0xE1B2BE, 0xE1B2BF,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE18FB0, 0xE18FB1, 0xE18FB2, 0xE18FB3, 0xE18FB4, 0xE18FB5, 0x0, 0x0,
+    },
+    {
+        0xD092, 0xD094, 0xD09E, 0xD0A1, 0xD0A2, 0xD0A2, 0xD0AA, 0xD1A2,
+        0xEA998A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xEA9DBD, 0x0, 0x0, 0x0, 0xE2B1A3, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9F86, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0xE1B880, 0x0, 0xE1B882, 0x0, 0xE1B884, 0x0, 0xE1B886,
+        0x0, 0xE1B888, 0x0, 0xE1B88A, 0x0, 0xE1B88C, 0x0, 0xE1B88E,
+        0x0, 0xE1B890, 0x0, 0xE1B892, 0x0, 0xE1B894, 0x0, 0xE1B896,
+        0x0, 0xE1B898, 0x0, 0xE1B89A, 0x0, 0xE1B89C, 0x0, 0xE1B89E,
+        0x0, 0xE1B8A0, 0x0, 0xE1B8A2, 0x0, 0xE1B8A4, 0x0, 0xE1B8A6,
+        0x0, 0xE1B8A8, 0x0, 0xE1B8AA, 0x0, 0xE1B8AC, 0x0, 0xE1B8AE,
+        0x0, 0xE1B8B0, 0x0, 0xE1B8B2, 0x0, 0xE1B8B4, 0x0, 0xE1B8B6,
+        0x0, 0xE1B8B8, 0x0, 0xE1B8BA, 0x0, 0xE1B8BC, 0x0, 0xE1B8BE,
+    },
+    {
+        0x0, 0xE1B980, 0x0, 0xE1B982, 0x0, 0xE1B984, 0x0, 0xE1B986,
+        0x0, 0xE1B988, 0x0, 0xE1B98A, 0x0, 0xE1B98C, 0x0, 0xE1B98E,
+        0x0, 0xE1B990, 0x0, 0xE1B992, 0x0, 0xE1B994, 0x0, 0xE1B996,
+        0x0, 0xE1B998, 0x0, 0xE1B99A, 0x0, 0xE1B99C, 0x0, 0xE1B99E,
+        0x0, 0xE1B9A0, 0x0, 0xE1B9A2, 0x0, 0xE1B9A4, 0x0, 0xE1B9A6,
+        0x0, 0xE1B9A8, 0x0, 0xE1B9AA, 0x0, 0xE1B9AC, 0x0, 0xE1B9AE,
+        0x0, 0xE1B9B0, 0x0, 0xE1B9B2, 0x0, 0xE1B9B4, 0x0, 0xE1B9B6,
+        0x0, 0xE1B9B8, 0x0, 0xE1B9BA, 0x0, 0xE1B9BC, 0x0, 0xE1B9BE,
+    },
+    {
+        0x0, 0xE1BA80, 0x0, 0xE1BA82, 0x0, 0xE1BA84, 0x0, 0xE1BA86,
+        0x0, 0xE1BA88, 0x0, 0xE1BA8A, 0x0, 0xE1BA8C, 0x0, 0xE1BA8E,
+        0x0, 0xE1BA90, 0x0, 0xE1BA92, 0x0, 0xE1BA94, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xE1B9A0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xE1BAA0, 0x0, 0xE1BAA2, 0x0, 0xE1BAA4, 0x0, 0xE1BAA6,
+        0x0, 0xE1BAA8, 0x0, 0xE1BAAA, 0x0, 0xE1BAAC, 0x0, 0xE1BAAE,
+        0x0, 0xE1BAB0, 0x0, 0xE1BAB2, 0x0, 0xE1BAB4, 0x0, 0xE1BAB6,
+        0x0, 0xE1BAB8, 0x0, 0xE1BABA, 0x0, 0xE1BABC, 0x0, 0xE1BABE,
+    },
+    {
+        0x0, 0xE1BB80, 0x0, 0xE1BB82, 0x0, 0xE1BB84, 0x0, 0xE1BB86,
+        0x0, 0xE1BB88, 0x0, 0xE1BB8A, 0x0, 0xE1BB8C, 0x0, 0xE1BB8E,
+        0x0, 0xE1BB90, 0x0, 0xE1BB92, 0x0, 0xE1BB94, 0x0, 0xE1BB96,
+        0x0, 0xE1BB98, 0x0, 0xE1BB9A, 0x0, 0xE1BB9C, 0x0, 0xE1BB9E,
+        0x0, 0xE1BBA0, 0x0, 0xE1BBA2, 0x0, 0xE1BBA4, 0x0, 0xE1BBA6,
+        0x0, 0xE1BBA8, 0x0, 0xE1BBAA, 0x0, 0xE1BBAC, 0x0, 0xE1BBAE,
+        0x0, 0xE1BBB0, 0x0, 0xE1BBB2, 0x0, 0xE1BBB4, 0x0, 0xE1BBB6,
+        0x0, 0xE1BBB8, 0x0, 0xE1BBBA, 0x0, 0xE1BBBC, 0x0, 0xE1BBBE,
+    },
+    {
+        0xE1BC88, 0xE1BC89, 0xE1BC8A, 0xE1BC8B, 0xE1BC8C, 0xE1BC8D, 0xE1BC8E, 0xE1BC8F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BC98, 0xE1BC99, 0xE1BC9A, 0xE1BC9B, 0xE1BC9C, 0xE1BC9D, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BCA8, 0xE1BCA9, 0xE1BCAA, 0xE1BCAB, 0xE1BCAC, 0xE1BCAD, 0xE1BCAE, 0xE1BCAF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BCB8, 0xE1BCB9, 0xE1BCBA, 0xE1BCBB, 0xE1BCBC, 0xE1BCBD, 0xE1BCBE, 0xE1BCBF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xE1BD88, 0xE1BD89, 0xE1BD8A, 0xE1BD8B, 0xE1BD8C, 0xE1BD8D, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xE1BD99, 0x0, 0xE1BD9B, 0x0, 0xE1BD9D, 0x0, 0xE1BD9F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BDA8, 0xE1BDA9, 0xE1BDAA, 0xE1BDAB, 0xE1BDAC, 0xE1BDAD, 0xE1BDAE, 0xE1BDAF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BEBA, 0xE1BEBB, 0xE1BF88, 0xE1BF89, 0xE1BF8A, 0xE1BF8B, 0xE1BF9A, 0xE1BF9B,
+        0xE1BFB8, 0xE1BFB9, 0xE1BFAA, 0xE1BFAB, 0xE1BFBA, 0xE1BFBB, 0x0, 0x0,
+    },
+    {
+        0xE1BE88, 0xE1BE89, 0xE1BE8A, 0xE1BE8B, 0xE1BE8C, 0xE1BE8D, 0xE1BE8E, 0xE1BE8F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BE98, 0xE1BE99, 0xE1BE9A, 0xE1BE9B, 0xE1BE9C, 0xE1BE9D, 0xE1BE9E, 0xE1BE9F,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BEA8, 0xE1BEA9, 0xE1BEAA, 0xE1BEAB, 0xE1BEAC, 0xE1BEAD, 0xE1BEAE, 0xE1BEAF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BEB8, 0xE1BEB9, 0x0, 0xE1BEBC, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xCE99, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0xE1BF8C, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BF98, 0xE1BF99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE1BFA8, 0xE1BFA9, 0x0, 0x0, 0x0, 0xE1BFAC, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xE1BFBC, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE284B2, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE285A0, 0xE285A1, 0xE285A2, 0xE285A3, 0xE285A4, 0xE285A5, 0xE285A6, 0xE285A7,
+        0xE285A8, 0xE285A9, 0xE285AA, 0xE285AB, 0xE285AC, 0xE285AD, 0xE285AE, 0xE285AF,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0xE28683, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE292B6, 0xE292B7, 0xE292B8, 0xE292B9, 0xE292BA, 0xE292BB, 0xE292BC, 0xE292BD,
+        0xE292BE, 0xE292BF, 0xE29380, 0xE29381, 0xE29382, 0xE29383, 0xE29384, 0xE29385,
+        0xE29386, 0xE29387, 0xE29388, 0xE29389, 0xE2938A, 0xE2938B, 0xE2938C, 0xE2938D,
+        0xE2938E, 0xE2938F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE2B080, 0xE2B081, 0xE2B082, 0xE2B083, 0xE2B084, 0xE2B085, 0xE2B086, 0xE2B087,
+        0xE2B088, 0xE2B089, 0xE2B08A, 0xE2B08B, 0xE2B08C, 0xE2B08D, 0xE2B08E, 0xE2B08F,
+    },
+    {
+        0xE2B090, 0xE2B091, 0xE2B092, 0xE2B093, 0xE2B094, 0xE2B095, 0xE2B096, 0xE2B097,
+        0xE2B098, 0xE2B099, 0xE2B09A, 0xE2B09B, 0xE2B09C, 0xE2B09D, 0xE2B09E, 0xE2B09F,
+        0xE2B0A0, 0xE2B0A1, 0xE2B0A2, 0xE2B0A3, 0xE2B0A4, 0xE2B0A5, 0xE2B0A6, 0xE2B0A7,
+        0xE2B0A8, 0xE2B0A9, 0xE2B0AA, 0xE2B0AB, 0xE2B0AC, 0xE2B0AD, 0xE2B0AE, 0xE2B0AF,
+        0x0, 0xE2B1A0, 0x0, 0x0, 0x0, 0xC8BA, 0xC8BE, 0x0,
+        0xE2B1A7, 0x0, 0xE2B1A9, 0x0, 0xE2B1AB, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xE2B1B2, 0x0, 0x0, 0xE2B1B5, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0xE2B280, 0x0, 0xE2B282, 0x0, 0xE2B284, 0x0, 0xE2B286,
+        0x0, 0xE2B288, 0x0, 0xE2B28A, 0x0, 0xE2B28C, 0x0, 0xE2B28E,
+        0x0, 0xE2B290, 0x0, 0xE2B292, 0x0, 0xE2B294, 0x0, 0xE2B296,
+        0x0, 0xE2B298, 0x0, 0xE2B29A, 0x0, 0xE2B29C, 0x0, 0xE2B29E,
+        0x0, 0xE2B2A0, 0x0, 0xE2B2A2, 0x0, 0xE2B2A4, 0x0, 0xE2B2A6,
+        0x0, 0xE2B2A8, 0x0, 0xE2B2AA, 0x0, 0xE2B2AC, 0x0, 0xE2B2AE,
+        0x0, 0xE2B2B0, 0x0, 0xE2B2B2, 0x0, 0xE2B2B4, 0x0, 0xE2B2B6,
+        0x0, 0xE2B2B8, 0x0, 0xE2B2BA, 0x0, 0xE2B2BC, 0x0, 0xE2B2BE,
+    },
+    {
+        0x0, 0xE2B380, 0x0, 0xE2B382, 0x0, 0xE2B384, 0x0, 0xE2B386,
+        0x0, 0xE2B388, 0x0, 0xE2B38A, 0x0, 0xE2B38C, 0x0, 0xE2B38E,
+        0x0, 0xE2B390, 0x0, 0xE2B392, 0x0, 0xE2B394, 0x0, 0xE2B396,
+        0x0, 0xE2B398, 0x0, 0xE2B39A, 0x0, 0xE2B39C, 0x0, 0xE2B39E,
+        0x0, 0xE2B3A0, 0x0, 0xE2B3A2, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0xE2B3AB, 0x0, 0xE2B3AD, 0x0,
+        0x0, 0x0, 0x0, 0xE2B3B2, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xE182A0, 0xE182A1, 0xE182A2, 0xE182A3, 0xE182A4, 0xE182A5, 0xE182A6, 0xE182A7,
+        0xE182A8, 0xE182A9, 0xE182AA, 0xE182AB, 0xE182AC, 0xE182AD, 0xE182AE, 0xE182AF,
+        0xE182B0, 0xE182B1, 0xE182B2, 0xE182B3, 0xE182B4, 0xE182B5, 0xE182B6, 0xE182B7,
+        0xE182B8, 0xE182B9, 0xE182BA, 0xE182BB, 0xE182BC, 0xE182BD, 0xE182BE, 0xE182BF,
+        0xE18380, 0xE18381, 0xE18382, 0xE18383, 0xE18384, 0xE18385, 0x0, 0xE18387,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xE1838D, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0xEA9980, 0x0, 0xEA9982, 0x0, 0xEA9984, 0x0, 0xEA9986,
+        0x0, 0xEA9988, 0x0, 0xEA998A, 0x0, 0xEA998C, 0x0, 0xEA998E,
+        0x0, 0xEA9990, 0x0, 0xEA9992, 0x0, 0xEA9994, 0x0, 0xEA9996,
+        0x0, 0xEA9998, 0x0, 0xEA999A, 0x0, 0xEA999C, 0x0, 0xEA999E,
+        0x0, 0xEA99A0, 0x0, 0xEA99A2, 0x0, 0xEA99A4, 0x0, 0xEA99A6,
+        0x0, 0xEA99A8, 0x0, 0xEA99AA, 0x0, 0xEA99AC, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0xEA9A80, 0x0, 0xEA9A82, 0x0, 0xEA9A84, 0x0, 0xEA9A86,
+        0x0, 0xEA9A88, 0x0, 0xEA9A8A, 0x0, 0xEA9A8C, 0x0, 0xEA9A8E,
+        0x0, 0xEA9A90, 0x0, 0xEA9A92, 0x0, 0xEA9A94, 0x0, 0xEA9A96,
+        0x0, 0xEA9A98, 0x0, 0xEA9A9A, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xEA9CA2, 0x0, 0xEA9CA4, 0x0, 0xEA9CA6,
+        0x0, 0xEA9CA8, 0x0, 0xEA9CAA, 0x0, 0xEA9CAC, 0x0, 0xEA9CAE,
+        0x0, 0x0, 0x0, 0xEA9CB2, 0x0, 0xEA9CB4, 0x0, 0xEA9CB6,
+        0x0, 0xEA9CB8, 0x0, 0xEA9CBA, 0x0, 0xEA9CBC, 0x0, 0xEA9CBE,
+    },
+    {
+        0x0, 0xEA9D80, 0x0, 0xEA9D82, 0x0, 0xEA9D84, 0x0, 0xEA9D86,
+        0x0, 0xEA9D88, 0x0, 0xEA9D8A, 0x0, 0xEA9D8C, 0x0, 0xEA9D8E,
+        0x0, 0xEA9D90, 0x0, 0xEA9D92, 0x0, 0xEA9D94, 0x0, 0xEA9D96,
+        0x0, 0xEA9D98, 0x0, 0xEA9D9A, 0x0, 0xEA9D9C, 0x0, 0xEA9D9E,
+        0x0, 0xEA9DA0, 0x0, 0xEA9DA2, 0x0, 0xEA9DA4, 0x0, 0xEA9DA6,
+        0x0, 0xEA9DA8, 0x0, 0xEA9DAA, 0x0, 0xEA9DAC, 0x0, 0xEA9DAE,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xEA9DB9, 0x0, 0xEA9DBB, 0x0, 0x0, 0xEA9DBE,
+    },
+    {
+        0x0, 0xEA9E80, 0x0, 0xEA9E82, 0x0, 0xEA9E84, 0x0, 0xEA9E86,
+        0x0, 0x0, 0x0, 0x0, 0xEA9E8B, 0x0, 0x0, 0x0,
+        0x0, 0xEA9E90, 0x0, 0xEA9E92, 0xEA9F84, 0x0, 0x0, 0xEA9E96,
+        0x0, 0xEA9E98, 0x0, 0xEA9E9A, 0x0, 0xEA9E9C, 0x0, 0xEA9E9E,
+        0x0, 0xEA9EA0, 0x0, 0xEA9EA2, 0x0, 0xEA9EA4, 0x0, 0xEA9EA6,
+        0x0, 0xEA9EA8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9EB4, 0x0, 0xEA9EB6,
+        0x0, 0xEA9EB8, 0x0, 0xEA9EBA, 0x0, 0xEA9EBC, 0x0, 0xEA9EBE,
+    },
+    {
+        0x0, 0xEA9F80, 0x0, 0xEA9F82, 0x0, 0x0, 0x0, 0x0,
+        0xEA9F87, 0x0, 0xEA9F89, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0xEA9F90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9F96,
+        0x0, 0xEA9F98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xEA9FB5, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0xEA9EB3, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xE18EA0, 0xE18EA1, 0xE18EA2, 0xE18EA3, 0xE18EA4, 0xE18EA5, 0xE18EA6, 0xE18EA7,
+        0xE18EA8, 0xE18EA9, 0xE18EAA, 0xE18EAB, 0xE18EAC, 0xE18EAD, 0xE18EAE, 0xE18EAF,
+    },
+    {
+        0xE18EB0, 0xE18EB1, 0xE18EB2, 0xE18EB3, 0xE18EB4, 0xE18EB5, 0xE18EB6, 0xE18EB7,
+        0xE18EB8, 0xE18EB9, 0xE18EBA, 0xE18EBB, 0xE18EBC, 0xE18EBD, 0xE18EBE, 0xE18EBF,
+        0xE18F80, 0xE18F81, 0xE18F82, 0xE18F83, 0xE18F84, 0xE18F85, 0xE18F86, 0xE18F87,
+        0xE18F88, 0xE18F89, 0xE18F8A, 0xE18F8B, 0xE18F8C, 0xE18F8D, 0xE18F8E, 0xE18F8F,
+        0xE18F90, 0xE18F91, 0xE18F92, 0xE18F93, 0xE18F94, 0xE18F95, 0xE18F96, 0xE18F97,
+        0xE18F98, 0xE18F99, 0xE18F9A, 0xE18F9B, 0xE18F9C, 0xE18F9D, 0xE18F9E, 0xE18F9F,
+        0xE18FA0, 0xE18FA1, 0xE18FA2, 0xE18FA3, 0xE18FA4, 0xE18FA5, 0xE18FA6, 0xE18FA7,
+        0xE18FA8, 0xE18FA9, 0xE18FAA, 0xE18FAB, 0xE18FAC, 0xE18FAD, 0xE18FAE, 0xE18FAF,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0xEFBCA1, 0xEFBCA2, 0xEFBCA3, 0xEFBCA4, 0xEFBCA5, 0xEFBCA6, 0xEFBCA7,
+        0xEFBCA8, 0xEFBCA9, 0xEFBCAA, 0xEFBCAB, 0xEFBCAC, 0xEFBCAD, 0xEFBCAE, 0xEFBCAF,
+        0xEFBCB0, 0xEFBCB1, 0xEFBCB2, 0xEFBCB3, 0xEFBCB4, 0xEFBCB5, 0xEFBCB6, 0xEFBCB7,
+        0xEFBCB8, 0xEFBCB9, 0xEFBCBA, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xF0909080, 0xF0909081, 0xF0909082, 0xF0909083, 0xF0909084, 0xF0909085, 0xF0909086, 0xF0909087,
+        0xF0909088, 0xF0909089, 0xF090908A, 0xF090908B, 0xF090908C, 0xF090908D, 0xF090908E, 0xF090908F,
+        0xF0909090, 0xF0909091, 0xF0909092, 0xF0909093, 0xF0909094, 0xF0909095, 0xF0909096, 0xF0909097,
+    },
+    {
+        0xF0909098, 0xF0909099, 0xF090909A, 0xF090909B, 0xF090909C, 0xF090909D, 0xF090909E, 0xF090909F,
+        0xF09090A0, 0xF09090A1, 0xF09090A2, 0xF09090A3, 0xF09090A4, 0xF09090A5, 0xF09090A6, 0xF09090A7,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xF09092B0, 0xF09092B1, 0xF09092B2, 0xF09092B3, 0xF09092B4, 0xF09092B5, 0xF09092B6, 0xF09092B7,
+        0xF09092B8, 0xF09092B9, 0xF09092BA, 0xF09092BB, 0xF09092BC, 0xF09092BD, 0xF09092BE, 0xF09092BF,
+        0xF0909380, 0xF0909381, 0xF0909382, 0xF0909383, 0xF0909384, 0xF0909385, 0xF0909386, 0xF0909387,
+        0xF0909388, 0xF0909389, 0xF090938A, 0xF090938B, 0xF090938C, 0xF090938D, 0xF090938E, 0xF090938F,
+        0xF0909390, 0xF0909391, 0xF0909392, 0xF0909393, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF09095B0,
+        0xF09095B1, 0xF09095B2, 0xF09095B3, 0xF09095B4, 0xF09095B5, 0xF09095B6, 0xF09095B7, 0xF09095B8,
+        0xF09095B9, 0xF09095BA, 0x0, 0xF09095BC, 0xF09095BD, 0xF09095BE, 0xF09095BF, 0xF0909680,
+        0xF0909681, 0xF0909682, 0xF0909683, 0xF0909684, 0xF0909685, 0xF0909686, 0xF0909687, 0xF0909688,
+        0xF0909689, 0xF090968A, 0x0, 0xF090968C, 0xF090968D, 0xF090968E, 0xF090968F, 0xF0909690,
+        0xF0909691, 0xF0909692, 0x0, 0xF0909694, 0xF0909695, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xF090B280, 0xF090B281, 0xF090B282, 0xF090B283, 0xF090B284, 0xF090B285, 0xF090B286, 0xF090B287,
+        0xF090B288, 0xF090B289, 0xF090B28A, 0xF090B28B, 0xF090B28C, 0xF090B28D, 0xF090B28E, 0xF090B28F,
+        0xF090B290, 0xF090B291, 0xF090B292, 0xF090B293, 0xF090B294, 0xF090B295, 0xF090B296, 0xF090B297,
+        0xF090B298, 0xF090B299, 0xF090B29A, 0xF090B29B, 0xF090B29C, 0xF090B29D, 0xF090B29E, 0xF090B29F,
+        0xF090B2A0, 0xF090B2A1, 0xF090B2A2, 0xF090B2A3, 0xF090B2A4, 0xF090B2A5, 0xF090B2A6, 0xF090B2A7,
+        0xF090B2A8, 0xF090B2A9, 0xF090B2AA, 0xF090B2AB, 0xF090B2AC, 0xF090B2AD, 0xF090B2AE, 0xF090B2AF,
+        0xF090B2B0, 0xF090B2B1, 0xF090B2B2, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0xF091A2A0, 0xF091A2A1, 0xF091A2A2, 0xF091A2A3, 0xF091A2A4, 0xF091A2A5, 0xF091A2A6, 0xF091A2A7,
+        0xF091A2A8, 0xF091A2A9, 0xF091A2AA, 0xF091A2AB, 0xF091A2AC, 0xF091A2AD, 0xF091A2AE, 0xF091A2AF,
+        0xF091A2B0, 0xF091A2B1, 0xF091A2B2, 0xF091A2B3, 0xF091A2B4, 0xF091A2B5, 0xF091A2B6, 0xF091A2B7,
+        0xF091A2B8, 0xF091A2B9, 0xF091A2BA, 0xF091A2BB, 0xF091A2BC, 0xF091A2BD, 0xF091A2BE, 0xF091A2BF,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0xF096B980, 0xF096B981, 0xF096B982, 0xF096B983, 0xF096B984, 0xF096B985, 0xF096B986, 0xF096B987,
+        0xF096B988, 0xF096B989, 0xF096B98A, 0xF096B98B, 0xF096B98C, 0xF096B98D, 0xF096B98E, 0xF096B98F,
+        0xF096B990, 0xF096B991, 0xF096B992, 0xF096B993, 0xF096B994, 0xF096B995, 0xF096B996, 0xF096B997,
+        0xF096B998, 0xF096B999, 0xF096B99A, 0xF096B99B, 0xF096B99C, 0xF096B99D, 0xF096B99E, 0xF096B99F,
+    },
+    {
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0xF09EA480, 0xF09EA481, 0xF09EA482, 0xF09EA483, 0xF09EA484, 0xF09EA485,
+        0xF09EA486, 0xF09EA487, 0xF09EA488, 0xF09EA489, 0xF09EA48A, 0xF09EA48B, 0xF09EA48C, 0xF09EA48D,
+        0xF09EA48E, 0xF09EA48F, 0xF09EA490, 0xF09EA491, 0xF09EA492, 0xF09EA493, 0xF09EA494, 0xF09EA495,
+        0xF09EA496, 0xF09EA497, 0xF09EA498, 0xF09EA499, 0xF09EA49A, 0xF09EA49B, 0xF09EA49C, 0xF09EA49D,
+    },
+    {
+        0xF09EA49E, 0xF09EA49F, 0xF09EA4A0, 0xF09EA4A1, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    },
+};
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# Generate led_ucase.c, the Unicode simple case mapping tables of led.
+#
+#   ./led_ucase.py [UnicodeData.txt] > led_ucase.c
+#
+# Without UnicodeData.txt the Python unicodedata database is used, its full
+# case mapping is reduced to the simple one (single char results).
+#
+# The tables are indexed by the packed UTF-8 led_uchar_t: the codepoint
+# without its 6 low bits selects a block in stage1, the 6 low bits (low bits
+# of the last UTF-8 byte) select the entry in the block. Entries are packed
+# UTF-8 chars, 0 when the char has no mapping.
+
+import sys
+import unicodedata
+
+BLOCK_BITS = 6
+BLOCK_SIZE = 1 << BLOCK_BITS
+
+def mappings_from_file(path):
+    lower, upper = {}, {}
+    with open(path) as f:
+        for line in f:
+            fields = line.strip().split(';')
+            if len(fields) < 14:
+                continue
+            cp = int(fields[0], 16)
+            if fields[12]:
+                upper[cp] = int(fields[12], 16)
+            if fields[13]:
+                lower[cp] = int(fields[13], 16)
+    return lower, upper, 'UnicodeData.txt'
+
+def mappings_from_python():
+    lower, upper = {}, {}
+    for cp in range(0x80, 0x110000):
+        c = chr(cp)
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        cl = c.lower()
+        # U+0130 is the only char with a multi-chars lower case, its simple one is the first char
+        if cl != c:
+            lower[cp] = ord(cl[0])
+        cu = c.upper()
+        if len(cu) != 1:
+            # the title case gives the simple upper case of the chars with a special full upper case
+            cu = c.title()
+        if len(cu) == 1 and cu != c:
+            upper[cp] = ord(cu)
+    return lower, upper, 'Python unicodedata %s' % unicodedata.unidata_version
+
+def utf8_packed(cp):
+    return int.from_bytes(chr(cp).encode('utf-8'), 'big')
+
+def main():
+    lower, upper, source = mappings_from_file(sys.argv[1]) if len(sys.argv) > 1 else mappings_from_python()
+    # ASCII is converted directly by led
+    lower = {k: v for k, v in lower.items() if k >= 0x80}
+    upper = {k: v for k, v in upper.items() if k >= 0x80}
+
+    stage1_size = (max(list(lower) + list(upper)) >> BLOCK_BITS) + 1
+    blocks = [(tuple([0] * BLOCK_SIZE), tuple([0] * BLOCK_SIZE))]
+    index = {blocks[0]: 0}
+    stage1 = []
+    for ib in range(stage1_size):
+        cps = range(ib << BLOCK_BITS, (ib + 1) << BLOCK_BITS)
+        block = (tuple(utf8_packed(lower[cp]) if cp in lower else 0 for cp in cps),
+                 tuple(utf8_packed(upper[cp]) if cp in upper else 0 for cp in cps))
+        if block not in index:
+            index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(index[block])
+    assert len(blocks) <= 256
+
+    out = sys.stdout
+    out.write('// Generated by led_ucase.py from %s, do not edit.\n\n' % source)
+    out.write('#include "led.h"\n\n')
+    out.write('const size_t led_ucase_stage1_size = %d;\n\n' % stage1_size)
+    out.write('const uint8_t led_ucase_stage1[] = {\n')
+    for i in range(0, stage1_size, 16):
+        out.write('    ' + ' '.join('%d,' % v for v in stage1[i:i + 16]) + '\n')
+    out.write('};\n')
+    for name, k in (('lower', 0), ('upper', 1)):
+        out.write('\nconst led_uchar_t led_ucase_%s[][%d] = {\n' % (name, BLOCK_SIZE))
+        for block in blocks:
+            out.write('    {\n')
+            for i in range(0, BLOCK_SIZE, 8):
+                out.write('        ' + ' '.join('0x%X,' % v for v in block[k][i:i + 8]) + '\n')
+            out.write('    },\n')
+        out.write('};\n')
+
+main()
@@ -179,6 +179,327 @@ void test_led_str_find() {
     led_assert(led_str_find_str(&test,"shot") == led_str_len(&test), LED_ERR_INTERNAL, "test_led_str_find_str: test sub not found");
 }
 
+void test_led_str_match_iter() {
+    led_str_decl_str(test, "a1b22cé333");
+    led_str_match_iter_t iter;
+    size_t count = 0;
+
+    led_str_match_iter_init(&iter, led_regex_compile("[0-9]+", 0));
+    while (led_str_match_iter_next(&iter, &test)) {
+        led_debug("zone %lu %lu", iter.zone_start, iter.zone_stop);
+        count++;
+    }
+    led_assert(count == 3, LED_ERR_INTERNAL, "test_led_str_match_iter: error in count");
+    led_assert(iter.zone_start == 8 && iter.zone_stop == 11, LED_ERR_INTERNAL, "test_led_str_match_iter: last zone");
+    pcre2_code_free(iter.regex);
+    led_str_match_iter_free(&iter);
+
+    // empty matches must move forward one UTF-8 char at a time
+    led_str_decl_str(test2, "aéb");
+    count = 0;
+    led_str_match_iter_init(&iter, led_regex_compile("x*", 0));
+    while (led_str_match_iter_next(&iter, &test2)) {
+        led_debug("zone %lu %lu", iter.zone_start, iter.zone_stop);
+        count++;
+    }
+    led_assert(count == 4, LED_ERR_INTERNAL, "test_led_str_match_iter: error in empty match count");
+    pcre2_code_free(iter.regex);
+    led_str_match_iter_free(&iter);
+}
+
+void test_led_str_utf8() {
+    led_str_decl_str(test, "ÂÊÎ àéî 0123456789 abcdefghij €");
+    led_str_decl_str(test_inv, "a\x80" "b\xC3" "c\xE2\x82");
+
+    led_assert(led_str_isutf8(test.str, test.len), LED_ERR_INTERNAL, "test_led_str_utf8: valid");
+    led_assert(!led_str_isutf8(test_inv.str, test_inv.len), LED_ERR_INTERNAL, "test_led_str_utf8: invalid");
+    led_assert(!led_str_isutf8("\xC0\xAF", 2), LED_ERR_INTERNAL, "test_led_str_utf8: overlong");
+    led_assert(led_str_uchar_count(test.str, test.len) == 31, LED_ERR_INTERNAL, "test_led_str_utf8: count");
+    led_assert(led_str_pos_uchar_n(test.str, test.len, 30) == test.len - 3, LED_ERR_INTERNAL, "test_led_str_utf8: pos");
+    led_assert(led_str_pos_uchar_n(test.str, test.len, 40) == test.len, LED_ERR_INTERNAL, "test_led_str_utf8: pos out");
+
+    // invalid bytes are single byte chars
+    size_t count = 0;
+    led_str_foreach_uchar(&test_inv) count++;
+    led_assert(count == 7, LED_ERR_INTERNAL, "test_led_str_utf8: invalid chars count");
+    count = 0;
+    led_str_foreach_uchar_r(&test_inv) count++;
+    led_assert(count == 7, LED_ERR_INTERNAL, "test_led_str_utf8: invalid chars reverse count");
+}
+
+void test_led_str_app_case() {
+    led_str_decl_str(test, "Hello World, ÂÊÎ àéî and A LONGER ASCII TAIL [@Z]");
+    led_str_decl(res, 128);
+
+    led_assert(led_uchar_isalnum('z') && !led_uchar_isalnum('_') && !led_uchar_isalnum(0xC3A9), LED_ERR_INTERNAL, "test_led_str_app_case: isalnum");
+    led_assert(led_uchar_isspace('\t') && !led_uchar_isspace(0xC2A0), LED_ERR_INTERNAL, "test_led_str_app_case: isspace");
+
+    led_str_app_lower_zn(&res, &test, 0, led_str_len(&test));
+    led_debug("result: %s", led_str_str(&res));
+    led_assert(led_str_equal_str(&res, "hello world, âêî àéî and a longer ascii tail [@z]"), LED_ERR_INTERNAL, "test_led_str_app_case: lower");
+
+    led_str_empty(&res);
+    led_str_app_upper_zn(&res, &test, 6, led_str_len(&test));
+    led_debug("result: %s", led_str_str(&res));
+    led_assert(led_str_equal_str(&res, "WORLD, ÂÊÎ ÀÉÎ AND A LONGER ASCII TAIL [@Z]"), LED_ERR_INTERNAL, "test_led_str_app_case: upper");
+
+    // case mappings changing the char size
+    led_assert(led_uchar_toupper(led_uchar_of_str("ı")) == 'I', LED_ERR_INTERNAL, "test_led_str_app_case: upper size");
+    led_assert(led_uchar_tolower(led_uchar_of_str("Ⱥ")) == led_uchar_of_str("ⱥ"), LED_ERR_INTERNAL, "test_led_str_app_case: lower size");
+    led_assert(led_uchar_tolower(led_uchar_of_str("𐐀")) == led_uchar_of_str("𐐨"), LED_ERR_INTERNAL, "test_led_str_app_case: lower 4 bytes");
+}
+
+void test_led_uchar_set() {
+    led_uchar_set_t set;
+    const char* test = "a long first field without sep ;; second€ third";
+
+    led_uchar_set_init(&set, ";€");
+    size_t len = strlen(test);
+    size_t i = led_str_find_set(test, len, &set);
+    led_assert(i == 31, LED_ERR_INTERNAL, "test_led_uchar_set: find");
+    i += led_str_span_set(test + i, len - i, &set);
+    led_assert(i == 33, LED_ERR_INTERNAL, "test_led_uchar_set: span");
+    i += led_str_find_set(test + i, len - i, &set);
+    led_assert(i == 40, LED_ERR_INTERNAL, "test_led_uchar_set: find multi-bytes");
+}
+
+void test_led_str_find_csv() {
+    // quoted zone across a block boundary with escaped quotes
+    const char* test = "first,\"quoted, with \"\"sep\"\", over a block\",last";
+    size_t len = strlen(test);
+    bool quoted = false;
+
+    size_t i = led_str_find_csv(test, len, ',', &quoted);
+    led_assert(i == 5 && !quoted, LED_ERR_INTERNAL, "test_led_str_find_csv: first");
+    i += 1 + led_str_find_csv(test + i + 1, len - i - 1, ',', &quoted);
+    led_assert(i == 42 && !quoted, LED_ERR_INTERNAL, "test_led_str_find_csv: quoted");
+    i += 1 + led_str_find_csv(test + i + 1, len - i - 1, ',', &quoted);
+    led_assert(i == len, LED_ERR_INTERNAL, "test_led_str_find_csv: last");
+}
+
+void test_led_json_find() {
+    // escaped quotes and braces inside strings, nested object and array path
+    led_str_decl_str(test, "{\"id\": 1, \"tags\": [\"a\", \"}\"], \"user\": {\"name\": \"Zo\\\"e {x}\", \"ids\": [3, {\"k\": true}]}}");
+    const char* paths[][2] = {
+        { "id", "1" }, { "tags.1", "}" }, { "user.name", "Zo\"e {x}" }, { "user.ids.1.k", "true" }, { "user.ids.0", "3" }
+    };
+    size_t start, stop;
+    led_str_decl(value, 64);
+
+    led_foreach_int(sizeof paths / sizeof paths[0]) {
+        led_str_empty(&value);
+        led_assert(led_json_find(led_str_str(&test), led_str_len(&test), paths[foreach.i][0], &start, &stop), LED_ERR_INTERNAL, "test_led_json_find: %s not found", paths[foreach.i][0]);
+        led_str_app_json_zn(&value, &test, start, stop);
+        led_assert(led_str_equal_str(&value, paths[foreach.i][1]), LED_ERR_INTERNAL, "test_led_json_find: %s value %s", paths[foreach.i][0], led_str_str(&value));
+    }
+    led_assert(!led_json_find(led_str_str(&test), led_str_len(&test), "user.x", &start, &stop), LED_ERR_INTERNAL, "test_led_json_find: missing key");
+}
+
+void test_led_logfmt_split() {
+    // quoted value with escaped quotes and spaces, key without value
+    const char* test = "level=info msg=\"user \\\"bob\\\" in\" flag dur=12ms";
+    led_kv_span_t span[LED_KV_MAX];
+    size_t count = led_logfmt_split(test, strlen(test), span, LED_KV_MAX);
+
+    led_assert(count == 4, LED_ERR_INTERNAL, "test_led_logfmt_split: count %lu", count);
+    led_assert(!strncmp(test + span[1].kstart, "msg", span[1].kstop - span[1].kstart), LED_ERR_INTERNAL, "test_led_logfmt_split: quoted key");
+    led_assert(span[1].vstop - span[1].vstart == 17 && !strncmp(test + span[1].vstart, "\"user \\\"bob\\\" in\"", 17), LED_ERR_INTERNAL, "test_led_logfmt_split: quoted value");
+    led_assert(span[2].kstop - span[2].kstart == 4 && span[2].vstart == span[2].vstop, LED_ERR_INTERNAL, "test_led_logfmt_split: key without value");
+    led_assert(!strncmp(test + span[3].vstart, "12ms", span[3].vstop - span[3].vstart), LED_ERR_INTERNAL, "test_led_logfmt_split: last value");
+}
+
+void test_led_str_path() {
+    const char* paths[][3] = {
+        { "", "", "" }, { "/", "/", "/" }, { "//", "//", "/" }, { "///", "/", "/" },
+        { "a", "", "a" }, { "a//", "", "a" }, { "//a", "//", "a" }, { "/a/b//", "/a", "b" }, { "a//b", "a", "b" }
+    };
+    led_foreach_int(sizeof paths / sizeof paths[0]) {
+        led_str_decl_str(path, paths[foreach.i][0]);
+        size_t stop = led_str_len(&path);
+        size_t start = led_str_basename_zn(&path, 0, &stop);
+        led_debug("path: [%s] dir=%lu base=%lu-%lu", paths[foreach.i][0], led_str_dirname_zn(&path, 0, led_str_len(&path)), start, stop);
+        led_assert(led_str_dirname_zn(&path, 0, led_str_len(&path)) == strlen(paths[foreach.i][1]), LED_ERR_INTERNAL, "test_led_str_path: dirname");
+        led_assert(stop - start == strlen(paths[foreach.i][2]) && !strncmp(paths[foreach.i][0] + start, paths[foreach.i][2], stop - start), LED_ERR_INTERNAL, "test_led_str_path: basename");
+    }
+}
+
+void test_led_str_base64() {
+    led_str_decl_str(test, "héllo wörld!~?>");
+    led_str_decl(enc, 64);
+    led_str_decl(dec, 64);
+
+    led_str_app_base64_zn(&enc, &test, 0, led_str_len(&test), false);
+    led_assert(led_str_equal_str(&enc, "aMOpbGxvIHfDtnJsZCF+Pz4="), LED_ERR_INTERNAL, "test_led_str_base64: encode");
+    led_str_app_unbase64_zn(&dec, &enc, 0, led_str_len(&enc));
+    led_assert(led_str_equal(&dec, &test), LED_ERR_INTERNAL, "test_led_str_base64: decode");
+
+    led_str_empty(&enc);
+    led_str_empty(&dec);
+    led_str_app_base64_zn(&enc, &test, 0, led_str_len(&test), true);
+    led_assert(led_str_equal_str(&enc, "aMOpbGxvIHfDtnJsZCF-Pz4"), LED_ERR_INTERNAL, "test_led_str_base64: encode url");
+    led_str_app_unbase64_zn(&dec, &enc, 0, led_str_len(&enc));
+    led_assert(led_str_equal(&dec, &test), LED_ERR_INTERNAL, "test_led_str_base64: decode url");
+
+    led_str_empty(&enc);
+    led_str_empty(&dec);
+    led_str_app_hex_zn(&enc, &test, 0, led_str_len(&test));
+    led_assert(led_str_equal_str(&enc, "68c3a96c6c6f2077c3b6726c64217e3f3e"), LED_ERR_INTERNAL, "test_led_str_base64: hex encode");
+    led_str_app_unhex_zn(&dec, &enc, 0, led_str_len(&enc));
+    led_assert(led_str_equal(&dec, &test), LED_ERR_INTERNAL, "test_led_str_base64: hex decode");
+
+    // the SSSE3 paths give the same results as the portable ones, on both alphabets and with line breaks
+    char bytes[300];
+    led_foreach_int(sizeof bytes) bytes[foreach.i] = (char)(foreach.i * 7);
+    led_str_t bin;
+    led_str_init(&bin, bytes, sizeof bytes);
+    bin.len = sizeof bytes;
+    led_str_decl(enc_hw, 512);
+    led_str_decl(enc_sw, 512);
+    led_str_decl(dec_hw, 512);
+    led_str_decl(dec_sw, 512);
+    bool base64_hw = led_str_base64_hw;
+    led_foreach_int(2) {
+        bool url = foreach.i;
+        led_str_empty(&enc_hw); led_str_empty(&enc_sw); led_str_empty(&dec_hw); led_str_empty(&dec_sw);
+        led_str_codec_init();
+        led_str_app_base64_zn(&enc_hw, &bin, 1, bin.len, url);
+        led_str_app_unbase64_zn(&dec_hw, &enc_hw, 0, enc_hw.len);
+        led_assert(dec_hw.len == bin.len - 1 && !memcmp(dec_hw.str, bytes + 1, dec_hw.len), LED_ERR_INTERNAL, "test_led_str_base64: decode");
+        led_str_empty(&dec_hw);
+        enc_hw.str[100] = '\n';
+        led_str_app_unbase64_zn(&dec_hw, &enc_hw, 0, enc_hw.len);
+        led_str_base64_hw = false;
+        led_str_app_base64_zn(&enc_sw, &bin, 1, bin.len, url);
+        enc_sw.str[100] = '\n';
+        led_str_app_unbase64_zn(&dec_sw, &enc_sw, 0, enc_sw.len);
+        led_assert(led_str_equal(&enc_hw, &enc_sw), LED_ERR_INTERNAL, "test_led_str_base64: encode portable");
+        led_assert(led_str_equal(&dec_hw, &dec_sw), LED_ERR_INTERNAL, "test_led_str_base64: decode portable");
+    }
+    led_str_base64_hw = base64_hw;
+
+    // chunk cut before an incomplete quad, its chars compacted after the cut
+    char chunk[] = "aMOp\nbG\nx";
+    size_t len = strlen(chunk);
+    size_t cut = led_str_unbase64_cut(chunk, &len);
+    led_assert(cut == 5 && len == 8 && !memcmp(chunk + cut, "bGx", 3), LED_ERR_INTERNAL, "test_led_str_base64: cut");
+}
+
+void test_led_hash() {
+    const char* test = "The quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy dog";
+    uint8_t digest[32], digest_sw[32];
+
+    led_hash_init();
+    led_assert(led_hash_xxh64("abc", 3, 0) == 0x44BC2CF5AD770999ULL, LED_ERR_INTERNAL, "test_led_hash: xxh64");
+    led_assert(led_hash_crc32c("123456789", 9) == 0xE3069283, LED_ERR_INTERNAL, "test_led_hash: crc32c");
+    led_hash_sha256(test, strlen(test), digest);
+    led_assert(digest[0] == 0x3d && digest[31] == 0x83, LED_ERR_INTERNAL, "test_led_hash: sha256");
+
+    // the portable paths give the same results as the hardware ones
+    bool crc32c_hw = led_hash_crc32c_hw, sha256_hw = led_hash_sha256_hw;
+    led_hash_crc32c_hw = led_hash_sha256_hw = false;
+    led_assert(led_hash_crc32c("123456789", 9) == 0xE3069283, LED_ERR_INTERNAL, "test_led_hash: crc32c portable");
+    led_hash_sha256(test, strlen(test), digest_sw);
+    led_assert(memcmp(digest, digest_sw, sizeof digest) == 0, LED_ERR_INTERNAL, "test_led_hash: sha256 portable");
+    led_hash_crc32c_hw = crc32c_hw;
+    led_hash_sha256_hw = sha256_hw;
+}
+
+void test_led_dedup() {
+    led_dedup_t set = {0};
+    char key[16];
+
+    // growth keeps the keys found, exact compare on the arena
+    led_dedup_init(&set, true, LED_DEDUP_MAX);
+    led_foreach_int(10000) {
+        snprintf(key, sizeof key, "key%lu", foreach.i);
+        led_assert(led_dedup_add(&set, key, strlen(key), 0), LED_ERR_INTERNAL, "test_led_dedup: add %s", key);
+    }
+    led_assert(set.size > LED_DEDUP_MIN && set.count == 10000, LED_ERR_INTERNAL, "test_led_dedup: grow");
+    led_foreach_int(10000) {
+        snprintf(key, sizeof key, "key%lu", foreach.i);
+        led_assert(!led_dedup_add(&set, key, strlen(key), 0), LED_ERR_INTERNAL, "test_led_dedup: find %s", key);
+    }
+    led_assert(led_dedup_add(&set, "key1", 4, 1), LED_ERR_INTERNAL, "test_led_dedup: seed");
+    led_assert(led_dedup_memory(&set) > set.size * sizeof(uint64_t), LED_ERR_INTERNAL, "test_led_dedup: memory");
+}
+
+void test_led_sort() {
+    led_sort_t sort = {0};
+    const char* lines[] = { "b 10", "a 9", "c -1", "a 10" };
+    char buf[64];
+
+    // numeric key on the second word, stable on equal keys
+    led_sort_init(&sort, 0, true, false);
+    led_foreach_int(4)
+        led_sort_add(&sort, lines[foreach.i], strlen(lines[foreach.i]), 2, strlen(lines[foreach.i]));
+    FILE* file = tmpfile();
+    led_assert(led_sort_flush(&sort, file) == 4, LED_ERR_INTERNAL, "test_led_sort: flush count");
+    rewind(file);
+    size_t len = fread(buf, 1, sizeof buf - 1, file);
+    buf[len] = '\0';
+    fclose(file);
+    led_debug("result: %s", buf);
+    led_assert(strcmp(buf, "c -1\na 9\nb 10\na 10\n") == 0, LED_ERR_INTERNAL, "test_led_sort: order");
+}
+
+void test_led_aes() {
+    uint8_t key[32], block[16], tag[16], iv[12] = {0}, data[100], data_sw[100];
+    led_aes_t aes;
+    led_aes_gcm_t gcm;
+
+    // FIPS-197 AES-256 block
+    led_foreach_int(32) key[foreach.i] = foreach.i;
+    led_foreach_int(16) block[foreach.i] = foreach.i * 0x11;
+    led_aes_init(&aes, key);
+    led_aes_encrypt_block(aes.rk, block, block);
+    led_assert(block[0] == 0x8e && block[15] == 0x89, LED_ERR_INTERNAL, "test_led_aes: block");
+
+    // GCM test case 14: zero key, zero IV, one zero block
+    memset(key, 0, sizeof key);
+    memset(block, 0, sizeof block);
+    led_aes_init(&aes, key);
+    led_aes_gcm_start(&gcm, &aes, iv);
+    led_aes_gcm_crypt(&gcm, block, sizeof block, true);
+    led_aes_gcm_finish(&gcm, tag);
+    led_assert(block[0] == 0xce && block[15] == 0x18, LED_ERR_INTERNAL, "test_led_aes: gcm cipher");
+    led_assert(tag[0] == 0xd0 && tag[15] == 0x19, LED_ERR_INTERNAL, "test_led_aes: gcm tag");
+
+    // the software path gives the same results as the hardware one, decrypt restores the text
+    led_foreach_int(100) data[foreach.i] = data_sw[foreach.i] = foreach.i;
+    led_aes_gcm_start(&gcm, &aes, iv);
+    led_aes_gcm_crypt(&gcm, data, sizeof data, true);
+    led_aes_gcm_finish(&gcm, tag);
+    aes.hw = false;
+    led_aes_gcm_start(&gcm, &aes, iv);
+    led_aes_gcm_crypt(&gcm, data_sw, 64, true);
+    led_aes_gcm_crypt(&gcm, data_sw + 64, 36, true);
+    led_aes_gcm_finish(&gcm, block);
+    led_assert(memcmp(data, data_sw, sizeof data) == 0 && memcmp(tag, block, sizeof tag) == 0, LED_ERR_INTERNAL, "test_led_aes: gcm software");
+    led_aes_gcm_start(&gcm, &aes, iv);
+    led_aes_gcm_crypt(&gcm, data_sw, sizeof data_sw, false);
+    led_aes_gcm_finish(&gcm, block);
+    led_assert(data_sw[99] == 99 && memcmp(tag, block, sizeof tag) == 0, LED_ERR_INTERNAL, "test_led_aes: gcm decrypt");
+}
+
+void test_led_uchar_map() {
+    static led_uchar_map_t map;
+    led_str_decl_str(test, "abc éa ÂÊÎ");
+    led_str_decl(res, 64);
+
+    led_uchar_map_init(&map);
+    led_uchar_map_set(&map, 'a', 'x');
+    led_assert(map.ascii_only, LED_ERR_INTERNAL, "test_led_uchar_map: ascii only");
+    led_uchar_map_set(&map, 0xC38A, 'e');
+    led_uchar_map_set(&map, 'b', 0xC3A9);
+    led_assert(!map.ascii_only, LED_ERR_INTERNAL, "test_led_uchar_map: not ascii only");
+    led_assert(led_uchar_map_get(&map, 0xC38A) == 'e', LED_ERR_INTERNAL, "test_led_uchar_map: get multi-bytes");
+    led_assert(led_uchar_map_get(&map, 0xC38E) == 0xC38E, LED_ERR_INTERNAL, "test_led_uchar_map: get not mapped");
+
+    led_str_app_map_zn(&res, &test, &map, 0, led_str_len(&test));
+    led_debug("result: %s", led_str_str(&res));
+    led_assert(led_str_equal_str(&res, "xéc éx ÂeÎ"), LED_ERR_INTERNAL, "test_led_uchar_map: app map");
+}
+
 //-----------------------------------------------
 // LEDTEST main
 //-----------------------------------------------
@@ -199,5 +520,19 @@ int main(int , char* []) {
     test(test_led_str_startswith_str);
     test(test_led_str_find_uchar);
     test(test_led_str_find);
+    test(test_led_str_match_iter);
+    test(test_led_str_utf8);
+    test(test_led_str_app_case);
+    test(test_led_uchar_map);
+    test(test_led_uchar_set);
+    test(test_led_str_find_csv);
+    test(test_led_json_find);
+    test(test_led_logfmt_split);
+    test(test_led_str_path);
+    test(test_led_str_base64);
+    test(test_led_hash);
+    test(test_led_dedup);
+    test(test_led_aes);
+    test(test_led_sort);
     return 0;
 }
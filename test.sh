@@ -46,6 +46,20 @@ app1_pwd: "_super_P@ssW0rd_" # strong password > 16
 app2_pwd: "_super_P@ssW0rd_" # strong password > 16
 EOT
 
+# lines of file_1 and file_2, out of files_in rewritten by the -F tests
+cat - > $TEST_DIR/file_lines<<EOT
+sdvmiksfqs
+TEST 11111111
+SLFKSLDkfj
+111111 TEST SDFMLSDF
+dfsldkfjsldf
+2222222
+TEST 22222222
+SLFKSLDkfj
+222222 TEST SDFMLSDF
+dfsldkfjsldf
+EOT
+
 cat - > $TEST_DIR/files_out/append<<EOT
 EXISTING LINE 1
 EXISTING LINE 2
@@ -122,6 +136,173 @@ if [[ $TEST == 13 || $TEST == all ]]; then
     ls $TEST_DIR/files_to_mv/* | $SCRIPT_DIR/led -v she// r// shu// fnc// 's//mv $R $0/' -X || exit 1
 fi
 
+if [[ $TEST == 14 || $TEST == all ]]; then
+    echo -e "\ntest 14:"
+    cat $TEST_DIR/files_in/file_pass | $SCRIPT_DIR/led -v '[a-z]+[0-9]' -M | $SCRIPT_DIR/led -v 'cu/^app/' -M || exit 1
+    # selector matches, then zone function on each match, lines without match are not output
+    MATCH=$(printf 'app1 foo2 bar\nnone\napp3\n' | $SCRIPT_DIR/led '[a-z]+[0-9]' -M | $SCRIPT_DIR/led 'cu/^app/' -M) || exit 1
+    [[ "$MATCH" == "$(printf 'APP\nAPP')" ]] || exit 1
+    MATCH=$(printf 'x1 x2\nnone\nx3\n' | $SCRIPT_DIR/led 'cu/x[0-9]/' -M) || exit 1
+    [[ "$MATCH" == "$(printf 'X1\nX2\nX3')" ]] || exit 1
+    # empty matches are skipped like grep -o
+    MATCH=$(printf 'ab\nxx\n' | $SCRIPT_DIR/led 'cu/x*/' -M) || exit 1
+    [[ "$MATCH" == "XX" ]] || exit 1
+    MATCH=$(printf 'ab\nxx\n' | $SCRIPT_DIR/led 'x*' -M) || exit 1
+    [[ "$MATCH" == "xx" ]] || exit 1
+    # whole line functions are rejected
+    printf 'x1 x2\n' | $SCRIPT_DIR/led 'i/x[0-9]/new/' -M && exit 1
+    printf 'x1 x2\n' | $SCRIPT_DIR/led 'd/x[0-9]/' -M && exit 1
+fi
+
+if [[ $TEST == 15 || $TEST == all ]]; then
+    echo -e "\ntest 15:"
+    cat $TEST_DIR/files_in/file_1 | $SCRIPT_DIR/led -v tml/ tmr/ cl/ tr//abc/xyz/ she/ || exit 1
+    # the fused run gives the same result as the chain, register breaks the fusion
+    FUSED=$(printf '  ABC caB dd  \n\tTEST 1 c d\n' | $SCRIPT_DIR/led tml/ tmr/ cl/ tr//abc/xyz/ she/) || exit 1
+    CHAIN=$(printf '  ABC caB dd  \n\tTEST 1 c d\n' | $SCRIPT_DIR/led tml/ r// tmr/ r// cl/ r// tr//abc/xyz/ r// she/) || exit 1
+    [[ "$FUSED" == "$CHAIN" ]] || exit 1
+    [[ "$FUSED" == "$(printf 'xyz\\ zxy\\ dd\ntest\\ 1\\ z\\ d')" ]] || exit 1
+fi
+
+if [[ $TEST == 16 || $TEST == all ]]; then
+    echo -e "\ntest 16:"
+    FLP=$(cat $TEST_DIR/file_lines | $SCRIPT_DIR/led -v 'flp//1,0/ /;') || exit 1
+    echo "$FLP"
+    [[ "$FLP" == "$(printf 'sdvmiksfqs\n11111111;TEST\nSLFKSLDkfj\nTEST;111111\ndfsldkfjsldf\n2222222\n22222222;TEST\nSLFKSLDkfj\nTEST;222222\ndfsldkfjsldf')" ]] || exit 1
+fi
+
+if [[ $TEST == 17 || $TEST == all ]]; then
+    echo -e "\ntest 17:"
+    FLQ=$(echo 'a,"b, ""c""",d' | $SCRIPT_DIR/led -v -r 'flq//1') || exit 1
+    echo "$FLQ"
+    [[ "$FLQ" == 'b, "c"' ]] || exit 1
+fi
+
+if [[ $TEST == 18 || $TEST == all ]]; then
+    echo -e "\ntest 18:"
+    JSV=$(echo '{"id": 1, "tags": ["a", "}"], "user": {"name": "Zo\"e"}}' | $SCRIPT_DIR/led -v 'jsv//user.name') || exit 1
+    echo "$JSV"
+    [[ "$JSV" == 'Zo"e' ]] || exit 1
+fi
+
+if [[ $TEST == 19 || $TEST == all ]]; then
+    echo -e "\ntest 19:"
+    LFV=$(echo 'level=info msg="user \"bob\" in" dur=12ms' | $SCRIPT_DIR/led -v 'lfv//level,dur/1' 'lfv//msg' 's//$R1 $R2 $0/') || exit 1
+    echo "$LFV"
+    [[ "$LFV" == 'info 12ms user "bob" in' ]] || exit 1
+    # the register usecase only reads the function zone
+    LFV=$(echo 'ts=1 msg="a b" lvl=info' | $SCRIPT_DIR/led 'lfv/msg.*/ts,lvl/0' 's//[$R0][$R1]/') || exit 1
+    [[ "$LFV" == '[][info]' ]] || exit 1
+    # a line rewritten with the same length is split again
+    LFV=$(echo 'ts=1 msg="a b" lvl=info' | $SCRIPT_DIR/led 'lfv//ts/0' 'tr//=/:/' 'r//' 'lfv//ts') || exit 1
+    [[ "$LFV" == '' ]] || exit 1
+fi
+
+if [[ $TEST == 20 || $TEST == all ]]; then
+    echo -e "\ntest 20:"
+    ls $TEST_DIR/files_to_mv/* | $SCRIPT_DIR/led -v urle/ | $SCRIPT_DIR/led -v urld/ she/ || exit 1
+    # round trip, non ASCII and reserved chars are encoded
+    URL=$(printf 'a b/é?&=%%\n' | $SCRIPT_DIR/led urle/) || exit 1
+    [[ "$URL" == "a%20b%2F%C3%A9%3F%26%3D%25" ]] || exit 1
+    URL=$(echo "$URL" | $SCRIPT_DIR/led urld/) || exit 1
+    [[ "$URL" == "a b/é?&=%" ]] || exit 1
+    # invalid sequences are left unchanged
+    URL=$(printf 'a%%zzb%%41%%\n' | $SCRIPT_DIR/led urld/) || exit 1
+    [[ "$URL" == "a%zzbA%" ]] || exit 1
+fi
+
+if [[ $TEST == 21 || $TEST == all ]]; then
+    echo -e "\ntest 21:"
+    RZ1=$(printf 'pwd: "abc123XYZ"\nnone\n' | $SCRIPT_DIR/led -S7 'rzan/"(.+)"/') || exit 1
+    RZ2=$(printf 'pwd: "abc123XYZ"\nnone\n' | $SCRIPT_DIR/led -S8 'rzan/"(.+)"/') || exit 1
+    echo "$RZ1"
+    # the same seed gives the same values on any run, another seed other values
+    [[ "$RZ1" == "$(printf 'pwd: "7ocEDbrEU"\nnone')" ]] || exit 1
+    [[ "$RZ1" != "$RZ2" ]] || exit 1
+fi
+
+if [[ $TEST == 22 || $TEST == all ]]; then
+    echo -e "\ntest 22:"
+    export LED_TEST_KEY=test_key
+    AES=$(echo 'app1_pwd: "_super_P@ssW0rd_"' | $SCRIPT_DIR/led 'aese/_pwd: "(.+)"/$LED_TEST_KEY' | $SCRIPT_DIR/led -v 'aesd/_pwd: "(.+)"/$LED_TEST_KEY') || exit 1
+    echo "$AES"
+    [[ "$AES" == 'app1_pwd: "_super_P@ssW0rd_"' ]] || exit 1
+fi
+
+if [[ $TEST == 23 || $TEST == all ]]; then
+    echo -e "\ntest 23:"
+    DD=$(cat $TEST_DIR/file_lines | $SCRIPT_DIR/led -v -r 'dd/^[A-Z]+') || exit 1
+    echo "$DD"
+    [[ "$DD" == "$(printf 'sdvmiksfqs\nTEST 11111111\nSLFKSLDkfj\n111111 TEST SDFMLSDF\ndfsldkfjsldf\n2222222\n222222 TEST SDFMLSDF\ndfsldkfjsldf')" ]] || exit 1
+    DD=$(cat $TEST_DIR/file_lines | $SCRIPT_DIR/led 'dd/^[A-Z]+' 'cl/') || exit 1
+    [[ "$DD" == "$(printf 'sdvmiksfqs\ntest 11111111\nslfksldkfj\n111111 test sdfmlsdf\ndfsldkfjsldf\n2222222\n222222 test sdfmlsdf\ndfsldkfjsldf')" ]] || exit 1
+    # a line is not deduplicated once per zone
+    printf 'x1 x2\n' | $SCRIPT_DIR/led 'dd/x[0-9]/' -M && exit 1
+    printf 'x1 x1\nx2\n' | $SCRIPT_DIR/led 'dde/x[0-9]/' -M && exit 1
+fi
+
+if [[ $TEST == 24 || $TEST == all ]]; then
+    echo -e "\ntest 24:"
+    SORT=$(cat $TEST_DIR/file_lines | $SCRIPT_DIR/led -v 'so/[0-9]+/nr') || exit 1
+    echo "$SORT"
+    [[ "$SORT" == "$(printf 'TEST 22222222\nTEST 11111111\n2222222\n222222 TEST SDFMLSDF\n111111 TEST SDFMLSDF\nsdvmiksfqs\nSLFKSLDkfj\ndfsldkfjsldf\nSLFKSLDkfj\ndfsldkfjsldf')" ]] || exit 1
+    # a line is not sorted once per zone
+    printf 'b1 b2\na1\n' | $SCRIPT_DIR/led 'so/[a-z][0-9]/' -M && exit 1
+fi
+
+if [[ $TEST == 25 || $TEST == all ]]; then
+    echo -e "\ntest 25:"
+    MEMO=$(cat $TEST_DIR/files_in/file_1 $TEST_DIR/files_in/file_1 | $SCRIPT_DIR/led -v -c -r 'TEST' 'cl/' 's/[0-9]+/N/') || exit 1
+    echo "$MEMO"
+    [[ "$MEMO" == "$(cat $TEST_DIR/files_in/file_1 $TEST_DIR/files_in/file_1 | $SCRIPT_DIR/led 'TEST' 'cl/' 's/[0-9]+/N/')" ]] || exit 1
+fi
+
+if [[ $TEST == 26 || $TEST == all ]]; then
+    echo -e "\ntest 26:"
+    seq 1 20000 > $TEST_DIR/file_seq
+    ROPE=$(cat $TEST_DIR/file_seq | $SCRIPT_DIR/led -r -p b64e/ | $SCRIPT_DIR/led -p b64d/ | md5sum) || exit 1
+    [[ "$ROPE" == "$(md5sum < $TEST_DIR/file_seq)" ]] || exit 1
+fi
+
+if [[ $TEST == 27 || $TEST == all ]]; then
+    echo -e "\ntest 27:"
+    CTX=$(cat $TEST_DIR/file_lines | $SCRIPT_DIR/led -v '^2+$' -2 3) || exit 1
+    echo "$CTX"
+    [[ "$CTX" == "$(printf '111111 TEST SDFMLSDF\ndfsldkfjsldf\n2222222')" ]] || exit 1
+    CTX=$(cat $TEST_DIR/file_lines | $SCRIPT_DIR/led 'TEST' -2 3) || exit 1
+    echo "$CTX"
+    [[ "$CTX" == "$(cat $TEST_DIR/file_lines | grep -B2 'TEST')" ]] || exit 1
+    # a match in the first lines selects fewer lines like grep
+    CTX=$(seq 60 | $SCRIPT_DIR/led '^[12]$' -2 3) || exit 1
+    [[ "$CTX" == "$(seq 60 | grep -B2 '^[12]$')" ]] || exit 1
+    CTX=$(seq 60 | $SCRIPT_DIR/led '^1$' -1 5) || exit 1
+    [[ "$CTX" == "$(seq 60 | grep -B1 -A3 '^1$')" ]] || exit 1
+    CTX=$(seq 60 | $SCRIPT_DIR/led '^1$' -2) || exit 1
+    [[ "$CTX" == "" ]] || exit 1
+fi
+
+if [[ $TEST == 28 || $TEST == all ]]; then
+    echo -e "\ntest 28:"
+    MEMO=$(printf 'x1\nb\nx2\nb\n' | $SCRIPT_DIR/led -c 'r/^x.*/' 's/b/$R/' 'a//R=$R') || exit 1
+    echo "$MEMO"
+    [[ "$MEMO" == "$(printf 'x1\nR=x1\nx1\nR=x1\nx2\nR=x2\nx2\nR=x2')" ]] || exit 1
+fi
+
+if [[ $TEST == 29 || $TEST == all ]]; then
+    echo -e "\ntest 29:"
+    printf "%032768d\nb\n" 0 > $TEST_DIR/file_max
+    [[ "$($SCRIPT_DIR/led '^' < $TEST_DIR/file_max | md5sum)" == "$(md5sum < $TEST_DIR/file_max)" ]] || exit 1
+    [[ "$($SCRIPT_DIR/led '^' < $TEST_DIR/file_max | wc -l)" == 2 ]] || exit 1
+fi
+
+if [[ $TEST == 30 || $TEST == all ]]; then
+    echo -e "\ntest 30:"
+    (printf "%099234d\n" 0; seq 1 10) > $TEST_DIR/file_long
+    ROPE=$(cat $TEST_DIR/file_long | $SCRIPT_DIR/led -p b64e/ | $SCRIPT_DIR/led -p b64d/ | md5sum) || exit 1
+    [[ "$ROPE" == "$(md5sum < $TEST_DIR/file_long)" ]] || exit 1
+    [[ "$(cat $TEST_DIR/file_long | $SCRIPT_DIR/led -p cu/ | wc -l)" == 11 ]] || exit 1
+fi
+
 echo -e "\nfiles:"
 ls -1 $TEST_DIR/files_in/*
 ls -1 $TEST_DIR/files_out/*